@@ -26,6 +26,19 @@ CODE ORGANIZATION:
 #include <iomanip>
 #include <algorithm>
 #include <cctype>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#include "../Shared/MappedCSVReader.h"
+#include "../Shared/ParallelCSVScanner.h"
+#include "../Shared/SeatBitmap.h"
+#include "../Shared/FleetSeatTree.h"
+#include "../Shared/SeatPositionIndex.h"
+#include "../Shared/FleetSnapshot.h"
+#include "../Shared/ReservationJournal.h"
+#include "../Shared/FleetStatistics.h"
+#include "../Shared/PassengerDictionary.h"
 
 using namespace std;
 
@@ -34,7 +47,7 @@ using namespace std;
 // ============================================================================
 
 const int SEATS_PER_PLANE = 180;
-const int MAX_PLANES = 1000;
+const int PLANES_PER_CHUNK = 16; // Planes allocated together when the fleet grows
 const int ROWS_PER_PLANE = 30;
 const int COLUMNS_PER_PLANE = 6;
 
@@ -42,41 +55,118 @@ const char AVAILABLE_SEAT = 'O';
 const char OCCUPIED_SEAT = 'X';
 
 const string COLUMN_LABELS = "ABCDEF";
-const string CSV_FILE_PATH = "C:\\Users\\User\\Dev\\C++\\Assignment-Data-Structure\\Source\\Array\\FlightPassengerDataArray.csv";
+// Data files (not const: useArrayDataFile points them at another CSV, e.g. a generated dataset)
+string CSV_FILE_PATH = "C:\\Users\\User\\Dev\\C++\\Assignment-Data-Structure\\Source\\Array\\FlightPassengerDataArray.csv";
+string SNAPSHOT_FILE_PATH = fleetSnapshotPathFor(CSV_FILE_PATH); // Binary image of the placed fleet, next to the CSV
+string JOURNAL_FILE_PATH = reservationJournalPathFor(CSV_FILE_PATH); // Bookings/cancellations since the CSV was written
 
 // ============================================================================
 // DATA STRUCTURES (SHARED BY BOTH TEAM MEMBERS)
 // ============================================================================
 
+// 12 bytes per seat: the ID is numeric, the class is one byte and the name
+// points into arrayPassengerNames (see passengerIdText / passengerNameText).
+// The plane is implied by which Plane holds the record.
 struct Passenger
 {
-    string passengerId;
-    string passengerName;
-    int planeNumber;
-    int seatRow;
-    int seatColumn;
-    string passengerClass;
+    uint32_t passengerId;
+    PassengerNameRef passengerName;
+    uint8_t seatRow;
+    uint8_t seatColumn;
+    PassengerClassCode passengerClass;
     bool isActive;
 
-    Passenger() : passengerId(""), passengerName(""), planeNumber(-1),
-                  seatRow(-1), seatColumn(-1), passengerClass(""), isActive(false) {}
+    Passenger() : passengerId(0), passengerName(), seatRow(0), seatColumn(0),
+                  passengerClass(PassengerClassCode::Economy), isActive(false) {}
 };
 
+static_assert(sizeof(Passenger) == 12, "Passenger should stay packed into 12 bytes");
+
 struct Plane
 {
     int planeNumber;
-    Passenger passengers[SEATS_PER_PLANE];               // 1D Array
-    char seatingGrid[ROWS_PER_PLANE][COLUMNS_PER_PLANE]; // 2D Array
+    Passenger passengers[SEATS_PER_PLANE];           // 1D Array addressed by seat slot (row*6+col)
+    SeatBitmap seatMap;                              // Packed 30x6 occupancy (bit row*6+col, 1 = occupied)
+    unsigned char occupiedSlots[SEATS_PER_PLANE];    // Compact list of occupied slots (first activePassengerCount entries)
+    unsigned char slotListPosition[SEATS_PER_PLANE]; // Where each occupied slot sits in occupiedSlots
     int activePassengerCount;
     bool isActive;
 
     Plane() : planeNumber(-1), activePassengerCount(0), isActive(false) {}
 };
 
+// Open-addressing hash index slot: passenger ID -> (planeIndex, passengerIndex)
+struct PassengerIdSlot
+{
+    size_t idHash;
+    int planeIndex; // -1 marks an empty slot
+    int passengerIndex;
+
+    PassengerIdSlot() : idHash(0), planeIndex(-1), passengerIndex(-1) {}
+};
+
+// Fleet of planes that grows one fixed-size chunk at a time.
+// Chunks are never moved or reallocated, so a Plane keeps its address for as
+// long as the fleet exists and planes[i] still reads like a 1D array.
+class PlaneFleet
+{
+private:
+    vector<unique_ptr<Plane[]>> chunks;
+
+public:
+    Plane &operator[](int planeIndex)
+    {
+        return chunks[planeIndex / PLANES_PER_CHUNK][planeIndex % PLANES_PER_CHUNK];
+    }
+
+    int capacity() const
+    {
+        return static_cast<int>(chunks.size()) * PLANES_PER_CHUNK;
+    }
+
+    // Allocates chunks until at least planeCount planes are addressable
+    void ensureCapacity(int planeCount)
+    {
+        while (capacity() < planeCount)
+            chunks.push_back(unique_ptr<Plane[]>(new Plane[PLANES_PER_CHUNK]));
+    }
+
+    // Releases every chunk (used when the data is reloaded)
+    void clear()
+    {
+        chunks.clear();
+        chunks.shrink_to_fit();
+    }
+
+    size_t reservedBytes() const
+    {
+        return chunks.size() * (PLANES_PER_CHUNK * sizeof(Plane) + sizeof(unique_ptr<Plane[]>));
+    }
+};
+
 // Global Arrays
-Plane planes[MAX_PLANES]; // 1D Array of planes
+PlaneFleet planes; // 1D array of planes, grown on demand
 int activePlaneCount = 0;
 
+// Passenger ID hash index (linear probing, kept at most half full)
+vector<PassengerIdSlot> passengerIdIndex;
+int passengerIdIndexCount = 0;
+
+// Free seats per class for every plane, as segment trees over plane indexes
+FleetFreeSeatTree arrayFreeSeatTree;
+
+// For each of the 180 seat positions, a bitset of the planes where it is taken
+SeatPositionIndex arraySeatPositionIndex;
+
+// Append-only log of changes made after loading (closed while loading)
+ReservationJournal arrayJournal;
+
+// Running totals (fleet, per class, per plane) kept up to date on every seat change
+FleetStatistics arrayFleetStatistics;
+
+// First/last name dictionaries and outlier arena behind every Passenger::passengerName
+PassengerNameDictionary arrayPassengerNames;
+
 // ============================================================================
 // FORWARD DECLARATIONS
 // ============================================================================
@@ -86,7 +176,7 @@ void handleReservation();
 void handleCancellation();
 bool insertReservation(const string &passengerId, const string &passengerName,
                        const string &passengerClass, int planeIndex, int seatRow, int seatColumn);
-bool cancelReservation(const string &passengerId);
+bool cancelReservation(const string &passengerId, ostream &log = cout);
 
 // TP083605 - Seat Lookup, Manifest, Seat Report
 void handleSeatLookup();
@@ -100,8 +190,13 @@ void displaySeatingChartForPlane(int planeIndex);
 
 // Shared functions
 void displayAllPassengersForCancellation();
-bool loadPassengerDataFromCSV();
-bool savePassengerDataToCSV();
+// The loaders report through log so a caller can capture them (e.g. per thread)
+bool loadPassengerDataFromCSV(ostream &log = cout);
+bool savePassengerDataToCSV(ostream &log = cout);
+bool loadPassengerDataFromSnapshot(ostream &log = cout);
+bool savePassengerDataToSnapshot();
+int replayPassengerDataJournal(ostream &log = cout);
+bool commitPassengerDataJournal();
 
 // ============================================================================
 // SECTION 1: SHARED/COMMON FUNCTIONS (USED BY BOTH TEAM MEMBERS)
@@ -168,6 +263,22 @@ char columnIndexToLetter(int columnIndex)
     return COLUMN_LABELS[columnIndex];
 }
 
+// Decoded text of the compact Passenger fields (for display and files)
+string passengerIdText(const Passenger &passenger)
+{
+    return to_string(passenger.passengerId);
+}
+
+string passengerNameText(const Passenger &passenger)
+{
+    return arrayPassengerNames.decode(passenger.passengerName);
+}
+
+const string &passengerClassText(const Passenger &passenger)
+{
+    return passengerClassName(passenger.passengerClass);
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 1.2 Plane Management Functions (1D Array Operations)
 // ────────────────────────────────────────────────────────────────────────────
@@ -178,88 +289,176 @@ void initializePlane(int planeIndex)
     planes[planeIndex].activePassengerCount = 0;
     planes[planeIndex].isActive = true;
 
-    // Initialize 2D seating grid
-    for (int row = 0; row < ROWS_PER_PLANE; row++)
-        for (int col = 0; col < COLUMNS_PER_PLANE; col++)
-            planes[planeIndex].seatingGrid[row][col] = AVAILABLE_SEAT;
+    // Initialize packed seat bitmap (all seats available)
+    planes[planeIndex].seatMap.reset();
 
     // Initialize 1D passengers array
     for (int i = 0; i < SEATS_PER_PLANE; i++)
         planes[planeIndex].passengers[i] = Passenger();
 }
 
-int createNewPlane()
+int createNewPlane(ostream &log = cout)
 {
-    if (activePlaneCount >= MAX_PLANES)
-    {
-        cout << "[ERROR] Maximum number of planes reached (" << MAX_PLANES << ").\n";
-        return -1;
-    }
-
     int newPlaneIndex = activePlaneCount;
+    planes.ensureCapacity(newPlaneIndex + 1);
     initializePlane(newPlaneIndex);
     activePlaneCount++;
+    arrayFreeSeatTree.ensurePlanes(activePlaneCount);
+    arraySeatPositionIndex.ensurePlanes(activePlaneCount);
+    arrayFleetStatistics.ensurePlanes(activePlaneCount);
 
-    cout << "[INFO] Created new Plane #" << (newPlaneIndex + 1) << "\n";
+    log << "[INFO] Created new Plane #" << (newPlaneIndex + 1) << "\n";
     return newPlaneIndex;
 }
 
 int findPlaneWithAvailableSeat()
 {
-    // Linear search through 1D array of planes
-    for (int i = 0; i < activePlaneCount; i++)
-    {
-        if (planes[i].isActive && planes[i].activePassengerCount < SEATS_PER_PLANE)
-            return i;
-    }
+    // Walk down the free-seat trees instead of scanning every plane
+    int planeIndex = arrayFreeSeatTree.findFirstPlaneWithFreeSeat(SEAT_CLASS_ANY);
+    if (planeIndex >= 0)
+        return planeIndex;
 
     return createNewPlane();
 }
 
+int findPlaneWithAvailableSeatInClass(const string &className)
+{
+    // First plane (lowest index) that still has a free seat in this class, or -1
+    return arrayFreeSeatTree.findFirstPlaneWithFreeSeat(seatClassIndex(className));
+}
+
 int getTotalPassengers()
 {
-    int total = 0;
-    // Traverse 1D array of planes
-    for (int i = 0; i < activePlaneCount; i++)
-        if (planes[i].isActive)
-            total += planes[i].activePassengerCount;
-    return total;
+    // Running counter, updated by allocateSeat / deallocateSeat
+    return arrayFleetStatistics.getTotalPassengers();
 }
 
 int getTotalAvailableSeats()
 {
-    int total = 0;
-    for (int i = 0; i < activePlaneCount; i++)
-        if (planes[i].isActive)
-            total += (SEATS_PER_PLANE - planes[i].activePassengerCount);
-    return total;
+    return arrayFleetStatistics.getTotalAvailableSeats();
 }
 
 // ────────────────────────────────────────────────────────────────────────────
-// 1.3 Search Functions (1D Array Search)
+// 1.3 Search Functions (Passenger ID Hash Index + 1D Array Search)
 // ────────────────────────────────────────────────────────────────────────────
 
-bool findPassengerByID(const string &passengerId, int &planeIndex, int &passengerIndex)
+size_t hashPassengerId(uint32_t passengerId)
 {
-    // Linear search through 1D array of planes
-    for (int p = 0; p < activePlaneCount; p++)
+    // splitmix64 finalizer: every input bit reaches the low bits the table
+    // masks, so IDs sharing a power-of-two stride still spread over all slots
+    uint64_t hash = static_cast<uint64_t>(passengerId) + 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<size_t>(hash ^ (hash >> 31));
+}
+
+void clearPassengerIdIndex()
+{
+    passengerIdIndex.assign(1024, PassengerIdSlot());
+    passengerIdIndexCount = 0;
+}
+
+void growPassengerIdIndex()
+{
+    vector<PassengerIdSlot> oldSlots;
+    oldSlots.swap(passengerIdIndex);
+    passengerIdIndex.assign(oldSlots.empty() ? 1024 : oldSlots.size() * 2, PassengerIdSlot());
+
+    size_t mask = passengerIdIndex.size() - 1;
+    for (const PassengerIdSlot &slot : oldSlots)
     {
-        if (!planes[p].isActive)
+        if (slot.planeIndex < 0)
             continue;
 
-        // Linear search through 1D array of passengers
-        for (int i = 0; i < planes[p].activePassengerCount; i++)
+        size_t position = slot.idHash & mask;
+        while (passengerIdIndex[position].planeIndex >= 0)
+            position = (position + 1) & mask;
+        passengerIdIndex[position] = slot;
+    }
+}
+
+// Returns the slot holding passengerId, or -1 if the ID is not indexed
+long long findPassengerIdSlot(uint32_t passengerId, size_t idHash)
+{
+    if (passengerIdIndex.empty())
+        return -1;
+
+    size_t mask = passengerIdIndex.size() - 1;
+    size_t position = idHash & mask;
+
+    // Probe until an empty slot ends the cluster
+    while (passengerIdIndex[position].planeIndex >= 0)
+    {
+        const PassengerIdSlot &slot = passengerIdIndex[position];
+        if (slot.idHash == idHash &&
+            planes[slot.planeIndex].passengers[slot.passengerIndex].passengerId == passengerId)
+            return static_cast<long long>(position);
+
+        position = (position + 1) & mask;
+    }
+    return -1;
+}
+
+void indexPassengerId(uint32_t passengerId, int planeIndex, int passengerIndex)
+{
+    if ((passengerIdIndexCount + 1) * 2 > static_cast<int>(passengerIdIndex.size()))
+        growPassengerIdIndex();
+
+    size_t idHash = hashPassengerId(passengerId);
+    size_t mask = passengerIdIndex.size() - 1;
+    size_t position = idHash & mask;
+
+    while (passengerIdIndex[position].planeIndex >= 0)
+        position = (position + 1) & mask;
+
+    passengerIdIndex[position].idHash = idHash;
+    passengerIdIndex[position].planeIndex = planeIndex;
+    passengerIdIndex[position].passengerIndex = passengerIndex;
+    passengerIdIndexCount++;
+}
+
+void unindexPassengerId(uint32_t passengerId)
+{
+    long long found = findPassengerIdSlot(passengerId, hashPassengerId(passengerId));
+    if (found < 0)
+        return;
+
+    // Backward-shift deletion keeps every probe chain intact without tombstones
+    size_t mask = passengerIdIndex.size() - 1;
+    size_t hole = static_cast<size_t>(found);
+    size_t position = (hole + 1) & mask;
+
+    while (passengerIdIndex[position].planeIndex >= 0)
+    {
+        size_t home = passengerIdIndex[position].idHash & mask;
+        // Move the entry back only if its home slot is not inside (hole, position]
+        if (((position - home) & mask) >= ((position - hole) & mask))
         {
-            if (planes[p].passengers[i].isActive &&
-                planes[p].passengers[i].passengerId == passengerId)
-            {
-                planeIndex = p;
-                passengerIndex = i;
-                return true;
-            }
+            passengerIdIndex[hole] = passengerIdIndex[position];
+            hole = position;
         }
+        position = (position + 1) & mask;
     }
-    return false;
+
+    passengerIdIndex[hole] = PassengerIdSlot();
+    passengerIdIndexCount--;
+}
+
+bool findPassengerByID(const string &passengerId, int &planeIndex, int &passengerIndex)
+{
+    // Only canonical numeric IDs are ever stored, so anything else is simply absent
+    uint32_t numericId;
+    if (!parsePassengerId32(passengerId, numericId))
+        return false;
+
+    // Constant-time lookup through the passenger ID hash index
+    long long found = findPassengerIdSlot(numericId, hashPassengerId(numericId));
+    if (found < 0)
+        return false;
+
+    planeIndex = passengerIdIndex[found].planeIndex;
+    passengerIndex = passengerIdIndex[found].passengerIndex;
+    return true;
 }
 
 bool findPassengerByNameOnPlane(const string &passengerName, int planeIndex, int &passengerIndex)
@@ -269,17 +468,15 @@ bool findPassengerByNameOnPlane(const string &passengerName, int planeIndex, int
     if (planeIndex < 0 || planeIndex >= activePlaneCount || !planes[planeIndex].isActive)
         return false;
 
-    // Linear search through 1D array of passengers on specific plane
-    for (int i = 0; i < planes[planeIndex].activePassengerCount; i++)
+    // Linear search through the occupied seat slots on specific plane
+    for (int k = 0; k < planes[planeIndex].activePassengerCount; k++)
     {
-        if (planes[planeIndex].passengers[i].isActive)
+        int slot = planes[planeIndex].occupiedSlots[k];
+        string storedNameUpper = toUpperCase(passengerNameText(planes[planeIndex].passengers[slot]));
+        if (storedNameUpper == searchNameUpper)
         {
-            string storedNameUpper = toUpperCase(planes[planeIndex].passengers[i].passengerName);
-            if (storedNameUpper == searchNameUpper)
-            {
-                passengerIndex = i;
-                return true;
-            }
+            passengerIndex = slot;
+            return true;
         }
     }
     return false;
@@ -287,7 +484,7 @@ bool findPassengerByNameOnPlane(const string &passengerName, int planeIndex, int
 
 string generateUniquePassengerID()
 {
-    int maxID = 99999;
+    uint32_t maxID = 99999;
 
     // Traverse all planes (1D array)
     for (int p = 0; p < activePlaneCount; p++)
@@ -295,15 +492,12 @@ string generateUniquePassengerID()
         if (!planes[p].isActive)
             continue;
 
-        // Traverse all passengers (1D array)
-        for (int i = 0; i < planes[p].activePassengerCount; i++)
+        // Traverse occupied seat slots only
+        for (int k = 0; k < planes[p].activePassengerCount; k++)
         {
-            if (planes[p].passengers[i].isActive && !planes[p].passengers[i].passengerId.empty())
-            {
-                int currentID = stoi(planes[p].passengers[i].passengerId);
-                if (currentID > maxID)
-                    maxID = currentID;
-            }
+            Passenger &pass = planes[p].passengers[planes[p].occupiedSlots[k]];
+            if (pass.passengerId > maxID)
+                maxID = pass.passengerId;
         }
     }
 
@@ -311,43 +505,73 @@ string generateUniquePassengerID()
 }
 
 // ────────────────────────────────────────────────────────────────────────────
-// 1.4 Seat Management Functions (2D Array Operations)
+// 1.4 Seat Management Functions (Packed Seat Bitmap Operations)
 // ────────────────────────────────────────────────────────────────────────────
 
 bool isSeatAvailable(int planeIndex, int seatRow, int seatColumn)
 {
-    // Direct access to 2D array
-    return planes[planeIndex].seatingGrid[seatRow][seatColumn] == AVAILABLE_SEAT;
+    int slot = seatSlotIndex(seatRow, seatColumn);
+    if (slot < 0)
+        return false;
+
+    // Direct bit test in the packed seat bitmap
+    return !planes[planeIndex].seatMap.test(slot);
 }
 
 void allocateSeat(int planeIndex, int seatRow, int seatColumn)
 {
-    // Update 2D array
-    planes[planeIndex].seatingGrid[seatRow][seatColumn] = OCCUPIED_SEAT;
+    // Set the seat bit
+    int slot = seatSlotIndex(seatRow, seatColumn);
+    planes[planeIndex].seatMap.set(slot);
+    arrayFreeSeatTree.adjustFreeSeats(planeIndex, seatClassOfRow(seatRow), -1);
+    arraySeatPositionIndex.setOccupied(planeIndex, slot, true);
+    arrayFleetStatistics.recordSeatTaken(planeIndex, seatClassOfRow(seatRow));
 }
 
 void deallocateSeat(int planeIndex, int seatRow, int seatColumn)
 {
-    // Update 2D array
-    planes[planeIndex].seatingGrid[seatRow][seatColumn] = AVAILABLE_SEAT;
+    // Clear the seat bit
+    int slot = seatSlotIndex(seatRow, seatColumn);
+    planes[planeIndex].seatMap.clear(slot);
+    arrayFreeSeatTree.adjustFreeSeats(planeIndex, seatClassOfRow(seatRow), +1);
+    arraySeatPositionIndex.setOccupied(planeIndex, slot, false);
+    arrayFleetStatistics.recordSeatFreed(planeIndex, seatClassOfRow(seatRow));
+}
+
+// First plane (lowest index) where this exact seat is free, or -1 if it is taken on every plane
+int findPlaneWithSeatAvailable(int seatRow, int seatColumn)
+{
+    return arraySeatPositionIndex.findFirstPlaneWithSeatFree(seatSlotIndex(seatRow, seatColumn));
+}
+
+// 'O'/'X' marker for one seat, derived from the bitmap only when rendering
+char getSeatMarker(int planeIndex, int seatRow, int seatColumn)
+{
+    return isSeatAvailable(planeIndex, seatRow, seatColumn) ? AVAILABLE_SEAT : OCCUPIED_SEAT;
 }
 
 int findAvailableSeat(int planeIndex, int &seatRow, int &seatColumn)
 {
-    // Sequential scan of 2D grid
-    for (int row = 0; row < ROWS_PER_PLANE; row++)
-    {
-        for (int col = 0; col < COLUMNS_PER_PLANE; col++)
-        {
-            if (isSeatAvailable(planeIndex, row, col))
-            {
-                seatRow = row;
-                seatColumn = col;
-                return planeIndex;
-            }
-        }
-    }
-    return -1;
+    // Count-trailing-zeros over the free bits of the whole plane
+    int slot = planes[planeIndex].seatMap.findFirstFree(SEAT_CLASS_ANY);
+    if (slot < 0)
+        return -1;
+
+    seatRow = slot / COLUMNS_PER_PLANE;
+    seatColumn = slot % COLUMNS_PER_PLANE;
+    return planeIndex;
+}
+
+bool findAvailableSeatInClass(int planeIndex, const string &className, int &seatRow, int &seatColumn)
+{
+    // Count-trailing-zeros over the free bits inside the class row mask
+    int slot = planes[planeIndex].seatMap.findFirstFree(seatClassIndex(className));
+    if (slot < 0)
+        return false;
+
+    seatRow = slot / COLUMNS_PER_PLANE;
+    seatColumn = slot % COLUMNS_PER_PLANE;
+    return true;
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -370,79 +594,72 @@ int countAvailableSeatsInClass(int planeIndex, const string &className)
     if (planeIndex < 0 || planeIndex >= activePlaneCount || !planes[planeIndex].isActive)
         return 0;
 
-    int count = 0;
-    int startRow, endRow;
-
-    if (className == "First")
-    {
-        startRow = 0;
-        endRow = 2;
-    }
-    else if (className == "Business")
-    {
-        startRow = 3;
-        endRow = 9;
-    }
-    else
-    {
-        startRow = 10;
-        endRow = 29;
-    }
-
-    // Scan 2D grid in class range
-    for (int row = startRow; row <= endRow; row++)
-    {
-        for (int col = 0; col < COLUMNS_PER_PLANE; col++)
-        {
-            if (planes[planeIndex].seatingGrid[row][col] == AVAILABLE_SEAT)
-            {
-                count++;
-            }
-        }
-    }
-
-    return count;
+    // Popcount of the free bits inside the class row mask
+    return planes[planeIndex].seatMap.countFree(seatClassIndex(className));
 }
 
 // ────────────────────────────────────────────────────────────────────────────
 // 1.6 CSV File I/O Functions
 // ────────────────────────────────────────────────────────────────────────────
 
-bool loadPassengerDataFromCSV()
+// Reads and writes csvFilePath (and the snapshot and journal next to it) from now on
+void useArrayDataFile(const string &csvFilePath)
 {
-    ifstream inputFile(CSV_FILE_PATH);
+    CSV_FILE_PATH = csvFilePath;
+    SNAPSHOT_FILE_PATH = fleetSnapshotPathFor(csvFilePath);
+    JOURNAL_FILE_PATH = reservationJournalPathFor(csvFilePath);
+}
+
+bool loadPassengerDataFromCSV(ostream &log)
+{
+    // Rows read back while loading are already on disk, so they are not journaled
+    arrayJournal.close();
+
+    // A snapshot that is still in step with the CSV skips parsing and seat placement
+    if (loadPassengerDataFromSnapshot(log))
+    {
+        replayPassengerDataJournal(log);
+        return true;
+    }
 
-    if (!inputFile.is_open())
+    MappedFile csvFile;
+
+    if (!csvFile.open(CSV_FILE_PATH))
     {
-        cout << "[WARNING] Could not open '" << CSV_FILE_PATH << "'.\n";
-        cout << "Starting with empty system.\n";
+        if (!csvFile.isMissing())
+        {
+            // The file is there but unreadable; writing it would wipe the data
+            log << "[ERROR] Could not read '" << CSV_FILE_PATH << "'. The file was left untouched.\n";
+            log << "Starting with empty system. Bookings will not be saved.\n";
+            return false;
+        }
+
+        log << "[WARNING] Could not find '" << CSV_FILE_PATH << "'.\n";
+        log << "Starting with empty system.\n";
+        // Create the file (header only) and start the journal against it, so
+        // bookings made from here on are recorded instead of silently dropped
+        savePassengerDataToCSV(log);
         return false;
     }
 
-    string line;
     int recordsLoaded = 0;
     int duplicateIDsSkipped = 0;
 
-    getline(inputFile, line); // Skip header
+    // Reused for every row so the scan does not allocate per passenger
+    string passengerId;
+    string passengerName;
 
-    while (getline(inputFile, line))
+    scanPassengerCSVParallel(csvFile.contents(), [&](const PassengerCSVRecord &record)
     {
-        if (line.empty())
-            continue;
-
-        stringstream ss(line);
-        string passengerId, passengerName, seatRowStr, seatColumnStr, passengerClass;
+        // Convert seat from CSV (1-30, A-F) to 0-indexed
+        int seatRow = record.seatRow - 1;                             // CSV: 1-30 → Code: 0-29
+        int seatColumn = columnLetterToIndex(record.seatColumnLetter); // A-F → 0-5
 
-        getline(ss, passengerId, ',');
-        getline(ss, passengerName, ',');
-        getline(ss, seatRowStr, ',');
-        getline(ss, seatColumnStr, ',');
-        getline(ss, passengerClass, ',');
+        if (seatRow < 0 || seatRow >= ROWS_PER_PLANE || seatColumn == -1)
+            return true; // Skip rows that point outside the seating grid
 
-        // Convert seat from CSV (1-30, A-F) to 0-indexed
-        int seatRow = stoi(seatRowStr) - 1; // CSV: 1-30 → Code: 0-29
-        char seatColLetter = seatColumnStr[0];
-        int seatColumn = columnLetterToIndex(seatColLetter); // A-F → 0-5
+        passengerId.assign(record.passengerId);
+        passengerName.assign(record.passengerName);
 
         // Auto-determine class from row
         string autoClass = getClassFromSeatRow(seatRow);
@@ -452,33 +669,24 @@ bool loadPassengerDataFromCSV()
         if (findPassengerByID(passengerId, dummyP, dummyI))
         {
             duplicateIDsSkipped++;
-            continue;
+            return true;
         }
 
         // ═══════════════════════════════════════════════════════════════════
         // NEW LOGIC: Use EXACT seat from CSV
         // Find a plane where this EXACT seat is available
         // ═══════════════════════════════════════════════════════════════════
-        int planeIndex = -1;
-
-        // Search through existing planes for this exact seat
-        for (int i = 0; i < activePlaneCount; i++)
-        {
-            if (isSeatAvailable(i, seatRow, seatColumn))
-            {
-                planeIndex = i;
-                break; // Found plane with this seat available
-            }
-        }
+        // Word-level scan of this seat position's bitset over the fleet
+        int planeIndex = findPlaneWithSeatAvailable(seatRow, seatColumn);
 
         // If seat taken on all existing planes, create new plane
         if (planeIndex == -1)
         {
-            planeIndex = createNewPlane();
+            planeIndex = createNewPlane(log);
             if (planeIndex == -1)
             {
-                cout << "[ERROR] Cannot create more planes. Stopping load.\n";
-                break;
+                log << "[ERROR] Cannot create more planes. Stopping load.\n";
+                return false;
             }
         }
 
@@ -487,28 +695,30 @@ bool loadPassengerDataFromCSV()
         {
             recordsLoaded++;
         }
-    }
+        return true;
+    });
 
-    inputFile.close();
-
-    cout << "\n[SUCCESS] CSV data loaded.\n";
-    cout << "Records Loaded: " << recordsLoaded << "\n";
+    log << "\n[SUCCESS] CSV data loaded.\n";
+    log << "Records Loaded: " << recordsLoaded << "\n";
     if (duplicateIDsSkipped > 0)
-        cout << "Duplicate IDs Skipped: " << duplicateIDsSkipped << "\n";
-    cout << "Total Planes Created: " << activePlaneCount << "\n";
-    cout << "Total Passengers: " << getTotalPassengers() << "\n";
-    cout << "Average passengers per plane: " << (getTotalPassengers() / activePlaneCount) << "\n";
-
+        log << "Duplicate IDs Skipped: " << duplicateIDsSkipped << "\n";
+    log << "Total Planes Created: " << activePlaneCount << "\n";
+    log << "Total Passengers: " << getTotalPassengers() << "\n";
+    if (activePlaneCount > 0)
+        log << "Average passengers per plane: " << (getTotalPassengers() / activePlaneCount) << "\n";
+
+    savePassengerDataToSnapshot();
+    replayPassengerDataJournal(log);
     return true;
 }
 
-bool savePassengerDataToCSV()
+bool savePassengerDataToCSV(ostream &log)
 {
     ofstream outputFile(CSV_FILE_PATH);
 
     if (!outputFile.is_open())
     {
-        cout << "[ERROR] Could not open '" << CSV_FILE_PATH << "' for writing.\n";
+        log << "[ERROR] Could not open '" << CSV_FILE_PATH << "' for writing.\n";
         return false;
     }
 
@@ -522,27 +732,143 @@ bool savePassengerDataToCSV()
         if (!planes[p].isActive)
             continue;
 
-        // Traverse all passengers (1D array)
-        for (int i = 0; i < SEATS_PER_PLANE; i++)
+        // Traverse occupied seat slots in booking order
+        for (int k = 0; k < planes[p].activePassengerCount; k++)
         {
-            if (planes[p].passengers[i].isActive)
-            {
-                Passenger &pass = planes[p].passengers[i];
+            Passenger &pass = planes[p].passengers[planes[p].occupiedSlots[k]];
 
-                outputFile << pass.passengerId << ","
-                           << pass.passengerName << ","
-                           << (pass.seatRow + 1) << ","
-                           << columnIndexToLetter(pass.seatColumn) << ","
-                           << pass.passengerClass << "\n";
+            outputFile << pass.passengerId << ","
+                       << passengerNameText(pass) << ","
+                       << (pass.seatRow + 1) << ","
+                       << columnIndexToLetter(pass.seatColumn) << ","
+                       << passengerClassText(pass) << "\n";
 
-                recordsSaved++;
-            }
+            recordsSaved++;
         }
     }
 
     outputFile.close();
 
-    cout << "\n[SUCCESS] " << recordsSaved << " passengers saved to CSV file.\n";
+    // Restamp the snapshot against the CSV that was just written; the CSV now
+    // holds everything the journal did, so the journal starts over empty
+    savePassengerDataToSnapshot();
+    arrayJournal.start(JOURNAL_FILE_PATH, CSV_FILE_PATH);
+
+    log << "\n[SUCCESS] " << recordsSaved << " passengers saved to CSV file.\n";
+    return true;
+}
+
+bool loadPassengerDataFromSnapshot(ostream &log)
+{
+    FleetSnapshotReader snapshot;
+    if (!snapshot.open(SNAPSHOT_FILE_PATH, CSV_FILE_PATH))
+        return false; // Missing or stale, the caller falls back to the CSV
+
+    // Recreate every plane up front (including empty ones) so plane numbers match
+    int planeCount = snapshot.getPlaneCount();
+    planes.ensureCapacity(planeCount);
+    for (int p = 0; p < planeCount; p++)
+        initializePlane(p);
+    activePlaneCount = planeCount;
+    arrayFreeSeatTree.ensurePlanes(activePlaneCount);
+    arraySeatPositionIndex.ensurePlanes(activePlaneCount);
+    arrayFleetStatistics.ensurePlanes(activePlaneCount);
+
+    string passengerId;
+    string passengerName;
+    string passengerClass;
+    int recordsLoaded = 0;
+
+    // Records are stored plane by plane in booking order, so each plane's
+    // occupied slot list comes back exactly as it was saved
+    for (int i = 0; i < snapshot.getRecordCount(); i++)
+    {
+        const FleetSnapshotRecord &record = snapshot.getRecord(i);
+        passengerId.assign(snapshot.getString(record.passengerIdRef));
+        passengerName.assign(snapshot.getString(record.passengerNameRef));
+        passengerClass.assign(snapshot.getString(record.passengerClassRef));
+
+        if (insertReservation(passengerId, passengerName, passengerClass, record.planeNumber - 1,
+                              record.seatSlot / COLUMNS_PER_PLANE, record.seatSlot % COLUMNS_PER_PLANE))
+            recordsLoaded++;
+    }
+
+    log << "\n[SUCCESS] Snapshot loaded.\n";
+    log << "Records Loaded: " << recordsLoaded << "\n";
+    log << "Total Planes: " << activePlaneCount << "\n";
+    log << "Total Passengers: " << getTotalPassengers() << "\n";
+    return true;
+}
+
+bool savePassengerDataToSnapshot()
+{
+    FleetSnapshotWriter snapshot;
+    snapshot.reserve(getTotalPassengers());
+
+    for (int p = 0; p < activePlaneCount; p++)
+    {
+        if (!planes[p].isActive)
+            continue;
+
+        for (int k = 0; k < planes[p].activePassengerCount; k++)
+        {
+            int slot = planes[p].occupiedSlots[k];
+            Passenger &pass = planes[p].passengers[slot];
+            snapshot.addRecord(passengerIdText(pass), passengerNameText(pass), passengerClassText(pass), p + 1, slot);
+        }
+    }
+
+    return snapshot.writeFile(SNAPSHOT_FILE_PATH, CSV_FILE_PATH, activePlaneCount);
+}
+
+// Re-applies the bookings and cancellations made since the CSV was last written,
+// then reopens the journal for appending. Returns the number of entries replayed.
+int replayPassengerDataJournal(ostream &log)
+{
+    string passengerId;
+    string passengerName;
+    string passengerClass;
+
+    int entriesReplayed = replayReservationJournal(JOURNAL_FILE_PATH, CSV_FILE_PATH, [&](const ReservationJournalEntry &entry)
+    {
+        passengerId.assign(entry.passenger.passengerId);
+        if (entry.operation == JOURNAL_CANCELLATION)
+        {
+            cancelReservation(passengerId, log);
+            return;
+        }
+
+        int seatRow = entry.passenger.seatRow - 1;
+        int seatColumn = columnLetterToIndex(entry.passenger.seatColumnLetter);
+        if (seatSlotIndex(seatRow, seatColumn) < 0)
+            return;
+
+        // Planes are created in order, so the journaled plane number is reproduced exactly
+        int planeIndex = entry.planeNumber - 1;
+        while (activePlaneCount <= planeIndex)
+            createNewPlane(log);
+
+        passengerName.assign(entry.passenger.passengerName);
+        passengerClass.assign(entry.passenger.passengerClass);
+        insertReservation(passengerId, passengerName, passengerClass, planeIndex, seatRow, seatColumn);
+    });
+
+    if (entriesReplayed > 0)
+        log << "Journal Entries Replayed: " << entriesReplayed << "\n";
+
+    arrayJournal.resume(JOURNAL_FILE_PATH, CSV_FILE_PATH, entriesReplayed);
+    return entriesReplayed;
+}
+
+// Group-commits the journal after a change. Once enough records have built up
+// they are compacted back into the CSV (and snapshot), which restarts the journal.
+bool commitPassengerDataJournal()
+{
+    if (!arrayJournal.commit())
+        return false;
+
+    if (arrayJournal.isCompactionDue())
+        return savePassengerDataToCSV();
     return true;
 }
 
@@ -587,13 +913,14 @@ void displayGlobalPassengerList(const string &filterClass = "")
         if (!planes[p].isActive || planes[p].activePassengerCount == 0)
             continue;
 
-        // Traverse 1D array of passengers
-        for (int i = 0; i < planes[p].activePassengerCount; i++)
+        // Traverse the compact list of occupied seat slots
+        for (int k = 0; k < planes[p].activePassengerCount; k++)
         {
+            int i = planes[p].occupiedSlots[k];
             if (planes[p].passengers[i].isActive)
             {
                 Passenger &pass = planes[p].passengers[i];
-                string classUpper = toUpperCase(pass.passengerClass);
+                string classUpper = toUpperCase(passengerClassText(pass));
 
                 if (filterClass.empty() || classUpper == filterUpper)
                 {
@@ -602,10 +929,10 @@ void displayGlobalPassengerList(const string &filterClass = "")
                     cout << left
                          << setw(5) << (++displayCount)
                          << setw(12) << pass.passengerId
-                         << setw(22) << pass.passengerName.substr(0, 20)
+                         << setw(22) << passengerNameText(pass).substr(0, 20)
                          << setw(8) << ("#" + to_string(p + 1))
                          << setw(8) << seat
-                         << setw(10) << pass.passengerClass
+                         << setw(10) << passengerClassText(pass)
                          << "\n";
 
                     totalCount++;
@@ -634,7 +961,7 @@ void displayAllPassengers()
 // ============================================================================
 // SECTION 2: TP079279 - RESERVATION (INSERTION) FUNCTIONS
 // ============================================================================
-// This section handles inserting passengers into the 1D and 2D arrays
+// This section handles inserting passengers into the 1D array and the seat bitmap
 // ============================================================================
 
 bool insertReservation(const string &passengerId, const string &passengerName,
@@ -647,6 +974,13 @@ bool insertReservation(const string &passengerId, const string &passengerName,
         return false;
     }
 
+    // The ID is stored as a 32-bit number, so it must be a canonical decimal ID
+    uint32_t numericId;
+    if (!parsePassengerId32(passengerId, numericId))
+    {
+        return false;
+    }
+
     // Check for duplicate ID globally (across all planes)
     int dummyPlane, dummyPass;
     if (findPassengerByID(passengerId, dummyPlane, dummyPass))
@@ -658,7 +992,7 @@ bool insertReservation(const string &passengerId, const string &passengerName,
     // NOTE: Duplicate name check removed to allow all passengers to load
     // Manual reservations still check for duplicates in handleReservation()
 
-    // Check if seat is available in 2D grid
+    // Check if seat is available in the seat bitmap
     if (!isSeatAvailable(planeIndex, seatRow, seatColumn))
     {
         return false;
@@ -671,24 +1005,33 @@ bool insertReservation(const string &passengerId, const string &passengerName,
     }
 
     // ═══════════════════════════════════════════════════════════════════════
-    // INSERTION INTO 1D ARRAY OF PASSENGERS
+    // INSERTION INTO 1D ARRAY OF PASSENGERS (slot = row * 6 + col)
     // ═══════════════════════════════════════════════════════════════════════
-    int passengerIndex = planes[planeIndex].activePassengerCount;
-
-    planes[planeIndex].passengers[passengerIndex].passengerId = passengerId;
-    planes[planeIndex].passengers[passengerIndex].passengerName = passengerName;
-    planes[planeIndex].passengers[passengerIndex].planeNumber = planeIndex;
-    planes[planeIndex].passengers[passengerIndex].seatRow = seatRow;
-    planes[planeIndex].passengers[passengerIndex].seatColumn = seatColumn;
-    planes[planeIndex].passengers[passengerIndex].passengerClass = passengerClass;
+    int passengerIndex = seatSlotIndex(seatRow, seatColumn);
+
+    planes[planeIndex].passengers[passengerIndex].passengerId = numericId;
+    planes[planeIndex].passengers[passengerIndex].passengerName = arrayPassengerNames.encode(passengerName);
+    planes[planeIndex].passengers[passengerIndex].seatRow = static_cast<uint8_t>(seatRow);
+    planes[planeIndex].passengers[passengerIndex].seatColumn = static_cast<uint8_t>(seatColumn);
+    planes[planeIndex].passengers[passengerIndex].passengerClass = passengerClassCodeOf(passengerClass);
     planes[planeIndex].passengers[passengerIndex].isActive = true;
 
+    // Keep the passenger ID hash index in sync
+    indexPassengerId(numericId, planeIndex, passengerIndex);
+
     // ═══════════════════════════════════════════════════════════════════════
-    // UPDATE 2D SEATING GRID
+    // UPDATE SEAT BITMAP
     // ═══════════════════════════════════════════════════════════════════════
     allocateSeat(planeIndex, seatRow, seatColumn);
 
-    planes[planeIndex].activePassengerCount++;
+    // Append the slot to the compact occupancy list
+    Plane &plane = planes[planeIndex];
+    plane.occupiedSlots[plane.activePassengerCount] = static_cast<unsigned char>(passengerIndex);
+    plane.slotListPosition[passengerIndex] = static_cast<unsigned char>(plane.activePassengerCount);
+    plane.activePassengerCount++;
+
+    // Durable once the journal is committed (no-op while loading)
+    arrayJournal.appendReservation(passengerId, passengerName, passengerClass, planeIndex + 1, seatRow, seatColumn);
 
     // Only show success message if called from manual reservation (not CSV load)
     // We detect this by checking if we're in the middle of bulk loading
@@ -792,7 +1135,7 @@ void handleReservation()
         }
     }
 
-    if (!hasAvailablePlane && activePlaneCount < MAX_PLANES)
+    if (!hasAvailablePlane)
     {
         cout << "\nNo planes with available " << passengerClass << " class seats.\n";
         cout << "A new plane will be created.\n";
@@ -804,12 +1147,6 @@ void handleReservation()
             return;
         }
     }
-    else if (!hasAvailablePlane)
-    {
-        cout << "[ERROR] No " << passengerClass << " class seats available and cannot create more planes.\n";
-        pauseForUserInput();
-        return;
-    }
 
     // Select plane
     int selectedPlane;
@@ -863,7 +1200,7 @@ void handleReservation()
         break;
     }
 
-    // Display seating grid (2D array visualization)
+    // Display seating grid (derived from the seat bitmap)
     clearScreen();
     cout << "\n========================================\n";
     cout << "    PLANE #" << (selectedPlane + 1) << " SEATING GRID\n";
@@ -882,7 +1219,7 @@ void handleReservation()
     {
         cout << setw(2) << (row + 1) << "   ";
         for (int col = 0; col < COLUMNS_PER_PLANE; col++)
-            cout << (planes[selectedPlane].seatingGrid[row][col] == AVAILABLE_SEAT ? " O  " : " X  ");
+            cout << (isSeatAvailable(selectedPlane, row, col) ? " O  " : " X  ");
         cout << "\n";
     }
 
@@ -893,7 +1230,7 @@ void handleReservation()
     {
         cout << setw(2) << (row + 1) << "   ";
         for (int col = 0; col < COLUMNS_PER_PLANE; col++)
-            cout << (planes[selectedPlane].seatingGrid[row][col] == AVAILABLE_SEAT ? " O  " : " X  ");
+            cout << (isSeatAvailable(selectedPlane, row, col) ? " O  " : " X  ");
         cout << "\n";
     }
 
@@ -904,7 +1241,7 @@ void handleReservation()
     {
         cout << setw(2) << (row + 1) << "   ";
         for (int col = 0; col < COLUMNS_PER_PLANE; col++)
-            cout << (planes[selectedPlane].seatingGrid[row][col] == AVAILABLE_SEAT ? " O  " : " X  ");
+            cout << (isSeatAvailable(selectedPlane, row, col) ? " O  " : " X  ");
         cout << "\n";
     }
 
@@ -1028,8 +1365,8 @@ void handleReservation()
     string passengerId = generateUniquePassengerID();
     insertReservation(passengerId, passengerName, actualClass, selectedPlane, seatRow, seatColumn);
 
-    // Save to CSV
-    savePassengerDataToCSV();
+    // Commit the booking to the journal
+    commitPassengerDataJournal();
 
     pauseForUserInput();
 }
@@ -1038,14 +1375,14 @@ void handleReservation()
 // SECTION 4: TP079279 - CANCELLATION FUNCTIONS (MENU 2)
 // ============================================================================
 
-bool cancelReservation(const string &passengerId)
+bool cancelReservation(const string &passengerId, ostream &log)
 {
     int planeIndex, passengerIndex;
 
-    // Search for passenger using linear search (1D arrays)
+    // Search for passenger through the ID hash index
     if (!findPassengerByID(passengerId, planeIndex, passengerIndex))
     {
-        cout << "\n[ERROR] Passenger ID '" << passengerId << "' not found!\n";
+        log << "\n[ERROR] Passenger ID '" << passengerId << "' not found!\n";
         return false;
     }
 
@@ -1053,30 +1390,36 @@ bool cancelReservation(const string &passengerId)
 
     int seatRow = passenger.seatRow;
     int seatColumn = passenger.seatColumn;
-    string passengerName = passenger.passengerName;
+    string passengerName = passengerNameText(passenger);
 
     // ═══════════════════════════════════════════════════════════════════════
-    // FREE SEAT IN 2D GRID
+    // FREE SEAT IN SEAT BITMAP
     // ═══════════════════════════════════════════════════════════════════════
     deallocateSeat(planeIndex, seatRow, seatColumn);
 
+    // Remove from the hash index while the record is still in place
+    unindexPassengerId(passenger.passengerId);
+
     // ═══════════════════════════════════════════════════════════════════════
-    // DELETE FROM 1D ARRAY (Shift elements left)
+    // DELETE FROM 1D ARRAY (Free the seat slot, no records are moved)
     // ═══════════════════════════════════════════════════════════════════════
-    for (int i = passengerIndex; i < planes[planeIndex].activePassengerCount - 1; i++)
-    {
-        planes[planeIndex].passengers[i] = planes[planeIndex].passengers[i + 1];
-    }
+    Plane &plane = planes[planeIndex];
+    passenger.isActive = false;
+
+    // Swap the last entry of the compact occupancy list into the freed position
+    int listPosition = plane.slotListPosition[passengerIndex];
+    int lastSlot = plane.occupiedSlots[plane.activePassengerCount - 1];
+    plane.occupiedSlots[listPosition] = static_cast<unsigned char>(lastSlot);
+    plane.slotListPosition[lastSlot] = static_cast<unsigned char>(listPosition);
+    plane.activePassengerCount--;
 
-    // Clear last slot
-    planes[planeIndex].passengers[planes[planeIndex].activePassengerCount - 1] = Passenger();
-    planes[planeIndex].activePassengerCount--;
+    arrayJournal.appendCancellation(passengerId);
 
-    cout << "\n[SUCCESS] Reservation cancelled successfully!\n";
-    cout << "Passenger ID: " << passengerId << "\n";
-    cout << "Name: " << passengerName << "\n";
-    cout << "Plane: #" << (planeIndex + 1) << "\n";
-    cout << "Freed Seat: " << (seatRow + 1) << columnIndexToLetter(seatColumn) << "\n";
+    log << "\n[SUCCESS] Reservation cancelled successfully!\n";
+    log << "Passenger ID: " << passengerId << "\n";
+    log << "Name: " << passengerName << "\n";
+    log << "Plane: #" << (planeIndex + 1) << "\n";
+    log << "Freed Seat: " << (seatRow + 1) << columnIndexToLetter(seatColumn) << "\n";
 
     return true;
 }
@@ -1120,7 +1463,7 @@ void handleCancellation()
 
     if (cancelReservation(passengerId))
     {
-        savePassengerDataToCSV();
+        commitPassengerDataJournal();
     }
 
     pauseForUserInput();
@@ -1142,7 +1485,7 @@ void displayPassengerDetails(int planeIndex, int passengerIndex)
 
     // Display passenger information
     cout << "Passenger ID   : " << p.passengerId << "\n";
-    cout << "Name           : " << p.passengerName << "\n";
+    cout << "Name           : " << passengerNameText(p) << "\n";
 
     // Plane index is stored as 0-based, so add 1 for display
     cout << "Plane          : #" << (planeIndex + 1) << "\n";
@@ -1153,7 +1496,7 @@ void displayPassengerDetails(int planeIndex, int passengerIndex)
          << columnIndexToLetter(p.seatColumn) << "\n";
 
     // Display passenger class (First, Business, or Economy)
-    cout << "Class          : " << p.passengerClass << "\n";
+    cout << "Class          : " << passengerClassText(p) << "\n";
 
     // Footer line
     cout << "========================================\n";
@@ -1189,7 +1532,7 @@ void handleSeatLookup()
     int planeIndex = -1;
     int passengerIndex = -1;
 
-    // Linear search through 1D arrays of planes and passengers
+    // Look up the passenger through the ID hash index
     if (findPassengerByID(passengerId, planeIndex, passengerIndex))
     {
         // If found, display passenger details
@@ -1249,9 +1592,11 @@ void displayManifestForPlane(int planeIndex)
 
     cout << "----------------------------------------\n";
 
-    // Traverse the 1D array of passengers for this plane
-    for (int i = 0; i < planes[planeIndex].activePassengerCount; i++)
+    // Traverse the occupied seat slots of this plane
+    for (int k = 0; k < planes[planeIndex].activePassengerCount; k++)
     {
+        int i = planes[planeIndex].occupiedSlots[k];
+
         // Skip inactive passengers
         if (!planes[planeIndex].passengers[i].isActive)
             continue;
@@ -1265,11 +1610,11 @@ void displayManifestForPlane(int planeIndex)
 
         // Display passenger details in table format
         cout << left
-             << setw(5) << (i + 1)
+             << setw(5) << (k + 1)
              << setw(12) << ps.passengerId
-             << setw(22) << ps.passengerName.substr(0, 20)
+             << setw(22) << passengerNameText(ps).substr(0, 20)
              << setw(8) << seat
-             << setw(10) << ps.passengerClass
+             << setw(10) << passengerClassText(ps)
              << "\n";
     }
 
@@ -1311,17 +1656,17 @@ void displayManifestForPlane_FilterByClass(int planeIndex, const string &classNa
 
     int no = 1; // Numbering ONLY for passengers that match the filter
 
-    // Traverse the 1D passenger array, but ONLY display passengers in the chosen class
-    for (int i = 0; i < planes[planeIndex].activePassengerCount; i++)
+    // Traverse the occupied seat slots, but ONLY display passengers in the chosen class
+    for (int k = 0; k < planes[planeIndex].activePassengerCount; k++)
     {
-        Passenger &ps = planes[planeIndex].passengers[i];
+        Passenger &ps = planes[planeIndex].passengers[planes[planeIndex].occupiedSlots[k]];
 
         // Skip inactive slots
         if (!ps.isActive)
             continue;
 
         // Skip passengers not in the requested class
-        if (ps.passengerClass != className)
+        if (passengerClassText(ps) != className)
             continue;
 
         // Convert seat position into readable format (e.g. 12A)
@@ -1332,9 +1677,9 @@ void displayManifestForPlane_FilterByClass(int planeIndex, const string &classNa
         cout << left
              << setw(5) << no++
              << setw(12) << ps.passengerId
-             << setw(22) << ps.passengerName.substr(0, 20)
+             << setw(22) << passengerNameText(ps).substr(0, 20)
              << setw(8) << seat
-             << setw(10) << ps.passengerClass
+             << setw(10) << passengerClassText(ps)
              << "\n";
     }
 
@@ -1367,36 +1712,27 @@ void displayPassengersInRow(int planeIndex, int rowNumber)
 
     int count = 0; // Counts how many passengers are found in that row
 
-    // Check the 2D seating grid for occupied seats in THIS row only
+    // Check the seat bitmap for occupied seats in THIS row only
     for (int col = 0; col < COLUMNS_PER_PLANE; col++)
     {
-        // If the seat is occupied in the grid, then a passenger must exist there
-        if (planes[planeIndex].seatingGrid[rowNumber][col] == OCCUPIED_SEAT)
+        // If the seat bit is set, then a passenger must exist there
+        if (!isSeatAvailable(planeIndex, rowNumber, col))
         {
-            // Now search the 1D passenger array to find the passenger who owns that seat
-            for (int i = 0; i < SEATS_PER_PLANE; i++)
-            {
-                Passenger &ps = planes[planeIndex].passengers[i];
-
-                // Match by seatRow + seatColumn
-                if (ps.isActive && ps.seatRow == rowNumber && ps.seatColumn == col)
-                {
-                    // Convert seat to readable format (e.g. 5C)
-                    string seat = to_string(ps.seatRow + 1);
-                    seat += columnIndexToLetter(ps.seatColumn);
-
-                    // Print passenger
-                    cout << left
-                         << setw(5) << (++count)
-                         << setw(8) << seat
-                         << setw(12) << ps.passengerId
-                         << setw(22) << ps.passengerName.substr(0, 20)
-                         << setw(10) << ps.passengerClass
-                         << "\n";
-
-                    break; // Stop searching once the passenger is found
-                }
-            }
+            // The passenger who owns that seat lives directly in its seat slot
+            Passenger &ps = planes[planeIndex].passengers[seatSlotIndex(rowNumber, col)];
+
+            // Convert seat to readable format (e.g. 5C)
+            string seat = to_string(ps.seatRow + 1);
+            seat += columnIndexToLetter(ps.seatColumn);
+
+            // Print passenger
+            cout << left
+                 << setw(5) << (++count)
+                 << setw(8) << seat
+                 << setw(12) << ps.passengerId
+                 << setw(22) << passengerNameText(ps).substr(0, 20)
+                 << setw(10) << passengerClassText(ps)
+                 << "\n";
         }
     }
 
@@ -1555,8 +1891,8 @@ void displaySeatingChartForPlane(int planeIndex)
         // Loop through all columns (A–F)
         for (int col = 0; col < COLUMNS_PER_PLANE; col++)
         {
-            // Print seat status from the 2D array
-            cout << " " << planes[planeIndex].seatingGrid[row][col] << "  ";
+            // Print seat status derived from the seat bitmap
+            cout << " " << getSeatMarker(planeIndex, row, col) << "  ";
         }
         cout << "\n";
     }
@@ -1570,7 +1906,7 @@ void displaySeatingChartForPlane(int planeIndex)
 
         for (int col = 0; col < COLUMNS_PER_PLANE; col++)
         {
-            cout << "   " << planes[planeIndex].seatingGrid[row][col];
+            cout << "   " << getSeatMarker(planeIndex, row, col);
         }
         cout << "\n";
     }
@@ -1584,7 +1920,7 @@ void displaySeatingChartForPlane(int planeIndex)
 
         for (int col = 0; col < COLUMNS_PER_PLANE; col++)
         {
-            cout << "   " << planes[planeIndex].seatingGrid[row][col];
+            cout << "   " << getSeatMarker(planeIndex, row, col);
         }
         cout << "\n";
     }
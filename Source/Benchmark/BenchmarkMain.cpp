@@ -0,0 +1,712 @@
+/*
+===============================================================================
+PLANE FLIGHT RESERVATION SYSTEM - HEADLESS BENCHMARK
+===============================================================================
+Component: Benchmark harness for the joint operations (all three backends)
+
+The joint menu times every operation once, and a single sub-microsecond
+timing is mostly clock noise. This executable loads the same data as the
+menu and then, for every operation and backend (Linked List, Unrolled List,
+Array), runs warmup batches followed by timed batches of calls on randomized
+keys. Each sample is the time per call over one batch; outliers are dropped
+(see Shared/BenchmarkStatistics.h) and the result is printed as JSON:
+min, median, p99 and ops/s per operation and backend.
+
+Every backend gets the same key sequence (same seed), so results compare
+directly. Reservations are cancelled again after every sample, and the
+journals are closed before measuring, so the data files are left untouched.
+The menu's data files are used unless --list-data / --array-data name
+others. A data file that does not exist, or a backend that loads no
+passengers, stops the run with an error instead of reporting timings of an
+empty fleet.
+
+Scaling mode (--scaling) instead generates a synthetic fleet at each of
+several sizes (Shared/SyntheticFleetData.h), times the CSV load and every
+operation at each size, and fits how each backend's median time grows with
+the number of rows: O(1), O(n) or O(n^2) (see Shared/BenchmarkStatistics.h).
+Given a previous scaling report as --baseline, any operation whose growth
+class got worse (and whose exponent rose by more than noise) is flagged and
+the exit status is 1, so a loader or lookup that turns quadratic shows up
+before it reaches 10M-row data.
+
+Build (from Source):  g++ -std=c++17 -O2 -pthread -o benchmark Benchmark/BenchmarkMain.cpp
+Usage:                benchmark [--list-data FILE] [--array-data FILE]
+                                [--samples N] [--warmup N] [--seed N] [--output FILE]
+                      benchmark --scaling [--sizes 2500,5000,...] [--data-dir DIR]
+                                [--baseline FILE] [--samples N] [--warmup N] [--seed N] [--output FILE]
+
+Examples:
+  benchmark --scaling --sizes 5k,10k,20k,40k,80k --output scaling_baseline.json
+  benchmark --scaling --sizes 5k,10k,20k,40k,80k --baseline scaling_baseline.json
+
+CODE ORGANIZATION:
+- Section 1: Configuration and Measurement
+- Section 2: Operations
+- Section 3: Scaling Mode
+- Section 4: JSON Report and Entry Point
+===============================================================================
+*/
+
+#define FLIGHT_RESERVATION_HEADLESS
+#include "../Main.cpp"
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+
+#include "../Shared/BenchmarkStatistics.h"
+#include "../Shared/SyntheticFleetData.h"
+
+using namespace std;
+
+/* ===========================================================
+          SECTION 1: CONFIGURATION AND MEASUREMENT
+   =========================================================== */
+
+const double BENCHMARK_MISS_RATE = 0.1; // Share of lookups for IDs that do not exist
+
+// Calls per timed batch, sized so one batch takes well over a microsecond
+const int LOOKUP_BATCH = 256;
+const int SEAT_POSITION_BATCH = 64;
+const int RESERVATION_BATCH = 64;
+const int MANIFEST_BATCH = 8;
+const int GLOBAL_LIST_BATCH = 1;
+
+const int SCALING_LOAD_REPEATS = 3;             // CSV loads timed per size and backend
+const double SCALING_REGRESSION_MARGIN = 0.5;   // Rise over the baseline exponent needed to flag it (half a class)
+
+struct BenchmarkConfig {
+    int samples = 50;
+    int warmup = 5;
+    uint32_t seed = 42;
+    string outputPath; // Empty = standard output
+
+    // Data files for the headless run (empty = the menu's own)
+    string listDataPath;  // Linked List and Unrolled List
+    string arrayDataPath; // Array
+
+    // Scaling mode
+    bool scaling = false;
+    vector<long long> sizes = {2500, 5000, 10000, 20000, 40000};
+    string dataDirectory = ".";  // Where the generated fleets are written (and removed again)
+    string baselinePath;         // Previous scaling report to compare against
+};
+
+struct BenchmarkResult {
+    string operation;
+    string backend;
+    int batch;
+    int failures; // Calls that did not do what they should (e.g. a cancellation that found nobody)
+    SampleSummary summary;
+};
+
+// Keeps results alive so the optimizer cannot drop the calls being timed
+volatile size_t benchmarkSink = 0;
+
+// Runs warmup + samples batches of `batch` calls, operation(callIndex), and
+// records the time per call of every batch after the warmup
+template <typename Operation>
+SampleSummary measureBatches(const BenchmarkConfig& config, int batch, Operation operation) {
+    vector<double> samplesNs;
+    samplesNs.reserve(config.samples);
+    int callIndex = 0;
+    for (int sample = 0; sample < config.warmup + config.samples; sample++) {
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < batch; i++) {
+            operation(callIndex++);
+        }
+        auto end = chrono::steady_clock::now();
+        if (sample >= config.warmup) {
+            samplesNs.push_back(chrono::duration<double, nano>(end - start).count() / batch);
+        }
+    }
+    return summarizeSamples(samplesNs);
+}
+
+/* ===========================================================
+                  SECTION 2: OPERATIONS
+   =========================================================== */
+
+// Every passenger ID currently booked (the backends hold the same passengers)
+vector<string> collectPassengerIds(PassengerLinkedList& list) {
+    vector<string> passengerIds;
+    passengerIds.reserve(list.getSize());
+    for (PassengerNode* current = list.getHead(); current != nullptr; current = current->next) {
+        passengerIds.push_back(current->passengerId);
+    }
+    return passengerIds;
+}
+
+// Lookup keys for every call of a run: existing IDs, plus misses past the largest ID
+vector<string> makeLookupKeys(const vector<string>& passengerIds, int nextId, size_t count, mt19937& random) {
+    vector<string> keys;
+    keys.reserve(count);
+    uniform_real_distribution<double> coin(0.0, 1.0);
+    for (size_t i = 0; i < count; i++) {
+        if (passengerIds.empty() || coin(random) < BENCHMARK_MISS_RATE) {
+            keys.push_back(to_string(nextId + static_cast<int>(random() % 1000000)));
+        } else {
+            keys.push_back(passengerIds[random() % passengerIds.size()]);
+        }
+    }
+    return keys;
+}
+
+void benchmarkLookups(const BenchmarkConfig& config, PassengerLinkedList& list, UnrolledPassengerList& unrolledList,
+                      const vector<string>& keys, vector<BenchmarkResult>& results) {
+    results.push_back({"lookup", "linkedList", LOOKUP_BATCH, 0, measureBatches(config, LOOKUP_BATCH, [&](int call) {
+        benchmarkSink = benchmarkSink + runLinkedListLookup(list, keys[call]).found;
+    })});
+    results.push_back({"lookup", "unrolledList", LOOKUP_BATCH, 0, measureBatches(config, LOOKUP_BATCH, [&](int call) {
+        benchmarkSink = benchmarkSink + runUnrolledListLookup(unrolledList, keys[call]).found;
+    })});
+    results.push_back({"lookup", "array", LOOKUP_BATCH, 0, measureBatches(config, LOOKUP_BATCH, [&](int call) {
+        benchmarkSink = benchmarkSink + runArrayLookup(keys[call]).found;
+    })});
+}
+
+void benchmarkSeatPositions(const BenchmarkConfig& config, PassengerLinkedList& list, UnrolledPassengerList& unrolledList,
+                            const vector<int>& seatSlots, vector<BenchmarkResult>& results) {
+    results.push_back({"seatPosition", "linkedList", SEAT_POSITION_BATCH, 0, measureBatches(config, SEAT_POSITION_BATCH, [&](int call) {
+        int slot = seatSlots[call];
+        benchmarkSink = benchmarkSink + runLinkedListSeatPositionQuery(list, slot / 6, slot % 6).occupiedPlaneCount;
+    })});
+    results.push_back({"seatPosition", "unrolledList", SEAT_POSITION_BATCH, 0, measureBatches(config, SEAT_POSITION_BATCH, [&](int call) {
+        int slot = seatSlots[call];
+        benchmarkSink = benchmarkSink + runUnrolledListSeatPositionQuery(unrolledList, slot / 6, slot % 6).occupiedPlaneCount;
+    })});
+    results.push_back({"seatPosition", "array", SEAT_POSITION_BATCH, 0, measureBatches(config, SEAT_POSITION_BATCH, [&](int call) {
+        int slot = seatSlots[call];
+        benchmarkSink = benchmarkSink + runArraySeatPositionQuery(slot / 6, slot % 6).occupiedPlaneCount;
+    })});
+}
+
+// planeNumbers are 1-based; the Array addresses plane N at index N - 1
+void benchmarkManifests(const BenchmarkConfig& config, PassengerLinkedList& list, UnrolledPassengerList& unrolledList,
+                        const vector<int>& planeNumbers, vector<BenchmarkResult>& results) {
+    results.push_back({"manifest", "linkedList", MANIFEST_BATCH, 0, measureBatches(config, MANIFEST_BATCH, [&](int call) {
+        benchmarkSink = benchmarkSink + collectLinkedListManifest(list, planeNumbers[call]).count;
+    })});
+    results.push_back({"manifest", "unrolledList", MANIFEST_BATCH, 0, measureBatches(config, MANIFEST_BATCH, [&](int call) {
+        benchmarkSink = benchmarkSink + collectUnrolledListManifest(unrolledList, planeNumbers[call]).count;
+    })});
+    results.push_back({"manifest", "array", MANIFEST_BATCH, 0, measureBatches(config, MANIFEST_BATCH, [&](int call) {
+        benchmarkSink = benchmarkSink + collectArrayManifest(planeNumbers[call] - 1).count;
+    })});
+}
+
+void benchmarkGlobalLists(const BenchmarkConfig& config, PassengerLinkedList& list, UnrolledPassengerList& unrolledList,
+                          vector<BenchmarkResult>& results) {
+    results.push_back({"globalList", "linkedList", GLOBAL_LIST_BATCH, 0, measureBatches(config, GLOBAL_LIST_BATCH, [&](int) {
+        benchmarkSink = benchmarkSink + static_cast<size_t>(runLinkedListGlobalList(list, ""));
+    })});
+    results.push_back({"globalList", "unrolledList", GLOBAL_LIST_BATCH, 0, measureBatches(config, GLOBAL_LIST_BATCH, [&](int) {
+        benchmarkSink = benchmarkSink + static_cast<size_t>(runUnrolledListGlobalList(unrolledList, ""));
+    })});
+    results.push_back({"globalList", "array", GLOBAL_LIST_BATCH, 0, measureBatches(config, GLOBAL_LIST_BATCH, [&](int) {
+        benchmarkSink = benchmarkSink + static_cast<size_t>(runArrayGlobalList("", true));
+    })});
+}
+
+// Every sample books RESERVATION_BATCH new passengers (timed), then cancels
+// them again in shuffled order (timed separately), so the fleet ends each
+// sample as it started. reserve(id, passengerClass) and cancel(id) return success.
+template <typename Reserve, typename Cancel>
+void benchmarkReservationCycle(const BenchmarkConfig& config, const string& backend, int firstNewId,
+                               Reserve reserve, Cancel cancel, vector<BenchmarkResult>& results) {
+    static const string classes[SEAT_CLASS_COUNT] = {"First", "Business", "Economy"};
+    mt19937 random(config.seed);
+
+    BenchmarkResult reserveResult{"reserve", backend, RESERVATION_BATCH, 0, SampleSummary()};
+    BenchmarkResult cancelResult{"cancel", backend, RESERVATION_BATCH, 0, SampleSummary()};
+    vector<double> reserveSamples;
+    vector<double> cancelSamples;
+    vector<string> batchIds(RESERVATION_BATCH);
+    vector<const string*> batchClasses(RESERVATION_BATCH);
+
+    for (int sample = 0; sample < config.warmup + config.samples; sample++) {
+        for (int i = 0; i < RESERVATION_BATCH; i++) {
+            batchIds[i] = to_string(firstNewId + i);
+            batchClasses[i] = &classes[random() % SEAT_CLASS_COUNT];
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < RESERVATION_BATCH; i++) {
+            if (!reserve(batchIds[i], *batchClasses[i])) {
+                reserveResult.failures++;
+            }
+        }
+        auto end = chrono::steady_clock::now();
+        double reserveNs = chrono::duration<double, nano>(end - start).count() / RESERVATION_BATCH;
+
+        shuffle(batchIds.begin(), batchIds.end(), random);
+        start = chrono::steady_clock::now();
+        for (int i = 0; i < RESERVATION_BATCH; i++) {
+            if (!cancel(batchIds[i])) {
+                cancelResult.failures++;
+            }
+        }
+        end = chrono::steady_clock::now();
+        double cancelNs = chrono::duration<double, nano>(end - start).count() / RESERVATION_BATCH;
+
+        if (sample >= config.warmup) {
+            reserveSamples.push_back(reserveNs);
+            cancelSamples.push_back(cancelNs);
+        }
+    }
+
+    reserveResult.summary = summarizeSamples(reserveSamples);
+    cancelResult.summary = summarizeSamples(cancelSamples);
+    results.push_back(reserveResult);
+    results.push_back(cancelResult);
+}
+
+void benchmarkReservations(const BenchmarkConfig& config, PassengerLinkedList& list, UnrolledPassengerList& unrolledList,
+                           int firstNewId, vector<BenchmarkResult>& results) {
+    const string passengerName = "Bench Passenger";
+    benchmarkReservationCycle(config, "linkedList", firstNewId,
+        [&](const string& id, const string& passengerClass) {
+            return runLinkedListReservation(list, id, passengerName, passengerClass, false, 0, 0).success;
+        },
+        [&](const string& id) {
+            return runLinkedListCancellation(list, id).success;
+        },
+        results);
+    benchmarkReservationCycle(config, "unrolledList", firstNewId,
+        [&](const string& id, const string& passengerClass) {
+            return runUnrolledListReservation(unrolledList, id, passengerName, passengerClass, false, 0, 0).success;
+        },
+        [&](const string& id) {
+            return runUnrolledListCancellation(unrolledList, id).success;
+        },
+        results);
+    benchmarkReservationCycle(config, "array", firstNewId,
+        [&](const string& id, const string& passengerClass) {
+            return runArrayReservation(id, passengerName, passengerClass, false, 0, 0).success;
+        },
+        [&](const string& id) {
+            return runArrayCancellation(id).success;
+        },
+        results);
+}
+
+// Runs every operation benchmark against the loaded fleet, with keys drawn
+// from config.seed so every backend (and every run) sees the same sequence
+vector<BenchmarkResult> runOperationBenchmarks(const BenchmarkConfig& config, PassengerLinkedList& list,
+                                               UnrolledPassengerList& unrolledList) {
+    mt19937 random(config.seed);
+
+    vector<string> passengerIds = collectPassengerIds(list);
+    int firstNewId = parseNumericId(generateJointPassengerId(list), 100000);
+    size_t callsPerRun = static_cast<size_t>(config.warmup + config.samples);
+
+    vector<string> lookupKeys = makeLookupKeys(passengerIds, firstNewId, callsPerRun * LOOKUP_BATCH, random);
+    vector<int> seatSlots(callsPerRun * SEAT_POSITION_BATCH);
+    for (int& slot : seatSlots) {
+        slot = static_cast<int>(random() % SEATS_PER_PLANE);
+    }
+    int planeCount = max(1, min({list.getTotalPlanes(), unrolledList.getTotalPlanes(), activePlaneCount}));
+    vector<int> planeNumbers(callsPerRun * MANIFEST_BATCH);
+    for (int& planeNumber : planeNumbers) {
+        planeNumber = 1 + static_cast<int>(random() % planeCount);
+    }
+
+    vector<BenchmarkResult> results;
+    benchmarkLookups(config, list, unrolledList, lookupKeys, results);
+    benchmarkSeatPositions(config, list, unrolledList, seatSlots, results);
+    benchmarkManifests(config, list, unrolledList, planeNumbers, results);
+    benchmarkGlobalLists(config, list, unrolledList, results);
+    benchmarkReservations(config, list, unrolledList, firstNewId, results);
+    return results;
+}
+
+/* ===========================================================
+                  SECTION 3: SCALING MODE
+   =========================================================== */
+
+struct ScalingPoint {
+    long long rows;
+    vector<BenchmarkResult> results;
+};
+
+struct ScalingCurve {
+    string operation;
+    string backend;
+    double exponent;        // Fitted slope of log(median time) against log(rows)
+    int growthClass;        // classifyGrowth(exponent)
+    int baselineClass;      // -1 when the baseline has no such curve
+    double baselineExponent;
+    bool regression;
+};
+
+// The files one backend reads at one size: the generated CSV, and the
+// snapshot and journal its loader writes next to it
+void removeFleetFiles(const string& csvPath) {
+    remove(csvPath.c_str());
+    remove(fleetSnapshotPathFor(csvPath).c_str());
+    remove(reservationJournalPathFor(csvPath).c_str());
+}
+
+// Times SCALING_LOAD_REPEATS full CSV loads per backend. The snapshot is
+// removed before every load, so each one parses and places every row
+// instead of reading back what the previous load saved.
+void benchmarkLoads(PassengerLinkedList& list, UnrolledPassengerList& unrolledList, vector<BenchmarkResult>& results) {
+    vector<double> linkedListNs, unrolledListNs, arrayNs;
+    OutputSilencer silencer;
+    for (int repeat = 0; repeat < SCALING_LOAD_REPEATS; repeat++) {
+        double loadMs = 0;
+        remove(snapshotFilePath.c_str());
+        loadLinkedListData(list, loadMs);
+        linkedListNs.push_back(loadMs * 1e6);
+
+        remove(snapshotFilePath.c_str());
+        loadUnrolledListData(unrolledList, loadMs);
+        unrolledListNs.push_back(loadMs * 1e6);
+
+        resetArrayData();
+        remove(SNAPSHOT_FILE_PATH.c_str());
+        loadArrayDataSilently(loadMs);
+        arrayNs.push_back(loadMs * 1e6);
+    }
+    results.push_back({"load", "linkedList", 1, 0, summarizeSamples(linkedListNs)});
+    results.push_back({"load", "unrolledList", 1, 0, summarizeSamples(unrolledListNs)});
+    results.push_back({"load", "array", 1, 0, summarizeSamples(arrayNs)});
+}
+
+// Generates, loads and measures one fleet of `rows` passengers. The Array
+// and the lists get identical copies of the CSV (their snapshots differ).
+bool measureScalingPoint(const BenchmarkConfig& config, long long rows, PassengerLinkedList& list,
+                         UnrolledPassengerList& unrolledList, ScalingPoint& point) {
+    SyntheticFleetOptions options;
+    options.rows = rows;
+    options.seed = config.seed;
+    string prefix = config.dataDirectory + "/SyntheticFleet_" + to_string(rows);
+    string listCsvPath = prefix + "_LinkedList.csv";
+    string arrayCsvPath = prefix + "_Array.csv";
+
+    SyntheticFleetSummary summary;
+    if (!writeSyntheticFleetCSV(listCsvPath, options, summary) ||
+        !writeSyntheticFleetCSV(arrayCsvPath, options, summary)) {
+        cerr << "Could not write the " << rows << "-row fleet to '" << config.dataDirectory << "'.\n";
+        removeFleetFiles(listCsvPath);
+        removeFleetFiles(arrayCsvPath);
+        return false;
+    }
+    usePassengerDataFile(listCsvPath);
+    useArrayDataFile(arrayCsvPath);
+
+    point.rows = rows;
+    point.results.clear();
+    benchmarkLoads(list, unrolledList, point.results);
+    // Nothing measured below may reach the data files
+    passengerJournal.close();
+    arrayJournal.close();
+
+    vector<BenchmarkResult> operations = runOperationBenchmarks(config, list, unrolledList);
+    point.results.insert(point.results.end(), operations.begin(), operations.end());
+
+    removeFleetFiles(listCsvPath);
+    removeFleetFiles(arrayCsvPath);
+    return true;
+}
+
+// Curves of an earlier scaling report: one line per curve, see writeScalingReport
+vector<ScalingCurve> readScalingBaseline(const string& baselinePath) {
+    vector<ScalingCurve> curves;
+    ifstream in(baselinePath);
+    string line;
+    while (getline(in, line)) {
+        string operation, backend, exponent, growth;
+        if (readJsonField(line, "operation", operation) && readJsonField(line, "backend", backend) &&
+            readJsonField(line, "exponent", exponent) && readJsonField(line, "growth", growth)) {
+            curves.push_back({operation, backend, atof(exponent.c_str()), growthClassFromName(growth), -1, 0, false});
+        }
+    }
+    return curves;
+}
+
+// One curve per (operation, backend), in the order the results were measured.
+// A curve regresses when it lands in a worse class than the baseline and its
+// exponent rose by at least SCALING_REGRESSION_MARGIN, so a curve sitting
+// near a class boundary is not flagged on noise alone. The baseline is
+// reclassified from its exponent, so reports written under other class
+// boundaries still compare like with like.
+vector<ScalingCurve> fitScalingCurves(const vector<ScalingPoint>& points, const vector<ScalingCurve>& baseline) {
+    vector<ScalingCurve> curves;
+    if (points.empty()) {
+        return curves;
+    }
+    for (size_t index = 0; index < points.front().results.size(); index++) {
+        const BenchmarkResult& first = points.front().results[index];
+        vector<double> sizes, times;
+        for (const ScalingPoint& point : points) {
+            sizes.push_back(static_cast<double>(point.rows));
+            times.push_back(point.results[index].summary.medianNs);
+        }
+
+        ScalingCurve curve{first.operation, first.backend, fitGrowthExponent(sizes, times), 0, -1, 0, false};
+        curve.growthClass = classifyGrowth(curve.exponent);
+        for (const ScalingCurve& previous : baseline) {
+            if (previous.operation == curve.operation && previous.backend == curve.backend) {
+                curve.baselineClass = classifyGrowth(previous.exponent);
+                curve.baselineExponent = previous.exponent;
+                curve.regression = curve.growthClass > curve.baselineClass &&
+                                   curve.exponent - previous.exponent >= SCALING_REGRESSION_MARGIN;
+            }
+        }
+        curves.push_back(curve);
+    }
+    return curves;
+}
+
+/* ===========================================================
+          SECTION 4: JSON REPORT AND ENTRY POINT
+   =========================================================== */
+
+void writeBenchmarkReport(ostream& out, const BenchmarkConfig& config, const LoadStats& stats,
+                          PassengerLinkedList& list, UnrolledPassengerList& unrolledList,
+                          const vector<BenchmarkResult>& results) {
+    out << "{\n";
+    out << "  \"config\": {\"samples\": " << config.samples << ", \"warmup\": " << config.warmup
+        << ", \"seed\": " << config.seed << ", \"missRate\": " << formatJsonNumber(BENCHMARK_MISS_RATE) << "},\n";
+    out << "  \"fleet\": {\n";
+    out << "    \"linkedList\": {\"passengers\": " << list.getSize() << ", \"planes\": " << list.getTotalPlanes()
+        << ", \"loadMs\": " << formatJsonNumber(stats.linkedListLoadMs) << "},\n";
+    out << "    \"unrolledList\": {\"passengers\": " << unrolledList.getSize() << ", \"planes\": " << unrolledList.getTotalPlanes()
+        << ", \"loadMs\": " << formatJsonNumber(stats.unrolledListLoadMs) << "},\n";
+    out << "    \"array\": {\"passengers\": " << getTotalPassengers() << ", \"planes\": " << activePlaneCount
+        << ", \"loadMs\": " << formatJsonNumber(stats.arrayLoadMs) << "}\n";
+    out << "  },\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchmarkResult& result = results[i];
+        out << "    {\"operation\": " << quoteJson(result.operation)
+            << ", \"backend\": " << quoteJson(result.backend)
+            << ", \"batch\": " << result.batch
+            << ", \"samples\": " << result.summary.samples
+            << ", \"outliersRemoved\": " << result.summary.outliersRemoved
+            << ", \"failures\": " << result.failures
+            << ", \"minNs\": " << formatJsonNumber(result.summary.minNs)
+            << ", \"medianNs\": " << formatJsonNumber(result.summary.medianNs)
+            << ", \"p99Ns\": " << formatJsonNumber(result.summary.p99Ns)
+            << ", \"opsPerSec\": " << formatJsonNumber(result.summary.opsPerSecond) << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// Curves are written one per line so readScalingBaseline can read the report back
+void writeScalingReport(ostream& out, const BenchmarkConfig& config, const vector<ScalingPoint>& points,
+                        const vector<ScalingCurve>& curves) {
+    int regressions = 0;
+    out << "{\n";
+    out << "  \"mode\": \"scaling\",\n";
+    out << "  \"config\": {\"samples\": " << config.samples << ", \"warmup\": " << config.warmup
+        << ", \"seed\": " << config.seed << ", \"loadRepeats\": " << SCALING_LOAD_REPEATS << ", \"sizes\": [";
+    for (size_t i = 0; i < config.sizes.size(); i++) {
+        out << (i > 0 ? ", " : "") << config.sizes[i];
+    }
+    out << "]},\n";
+    out << "  \"points\": [\n";
+    for (size_t i = 0; i < points.size(); i++) {
+        out << "    {\"rows\": " << points[i].rows << ", \"medianNs\": {";
+        for (size_t j = 0; j < points[i].results.size(); j++) {
+            const BenchmarkResult& result = points[i].results[j];
+            out << (j > 0 ? ", " : "") << quoteJson(result.operation + "/" + result.backend) << ": "
+                << formatJsonNumber(result.summary.medianNs);
+        }
+        out << "}}" << (i + 1 < points.size() ? ",\n" : "\n");
+    }
+    out << "  ],\n";
+    out << "  \"curves\": [\n";
+    for (size_t i = 0; i < curves.size(); i++) {
+        const ScalingCurve& curve = curves[i];
+        out << "    {\"operation\": " << quoteJson(curve.operation)
+            << ", \"backend\": " << quoteJson(curve.backend)
+            << ", \"exponent\": " << formatJsonNumber(curve.exponent)
+            << ", \"growth\": " << quoteJson(growthClassName(curve.growthClass));
+        if (curve.baselineClass >= 0) {
+            out << ", \"baselineExponent\": " << formatJsonNumber(curve.baselineExponent)
+                << ", \"baselineGrowth\": " << quoteJson(growthClassName(curve.baselineClass));
+        }
+        out << ", \"regression\": " << (curve.regression ? "true" : "false") << "}"
+            << (i + 1 < curves.size() ? ",\n" : "\n");
+        regressions += curve.regression ? 1 : 0;
+    }
+    out << "  ],\n";
+    out << "  \"regressions\": " << regressions << "\n";
+    out << "}\n";
+}
+
+// Human-readable summary on standard error, so the JSON stays clean on standard output
+void printScalingSummary(const vector<ScalingCurve>& curves) {
+    cerr << left << setw(14) << "operation" << setw(14) << "backend" << setw(10) << "exponent"
+         << setw(9) << "growth" << "baseline\n";
+    for (const ScalingCurve& curve : curves) {
+        cerr << left << setw(14) << curve.operation << setw(14) << curve.backend
+             << setw(10) << fixed << setprecision(2) << curve.exponent
+             << setw(9) << growthClassName(curve.growthClass)
+             << (curve.baselineClass >= 0 ? growthClassName(curve.baselineClass) : "-")
+             << (curve.regression ? "  REGRESSION" : "") << "\n";
+    }
+}
+
+bool parseSizeList(const string& text, vector<long long>& sizes) {
+    sizes.clear();
+    stringstream stream(text);
+    string label;
+    while (getline(stream, label, ',')) {
+        long long rows = parseSyntheticRowCount(label);
+        if (rows <= 0) {
+            return false;
+        }
+        sizes.push_back(rows);
+    }
+    sort(sizes.begin(), sizes.end());
+    sizes.erase(unique(sizes.begin(), sizes.end()), sizes.end());
+    return sizes.size() >= 2;
+}
+
+bool parseBenchmarkArguments(int argc, char* argv[], BenchmarkConfig& config) {
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        if (option == "--scaling") {
+            config.scaling = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            cerr << "Missing value for " << option << "\n";
+            return false;
+        }
+        string value = argv[++i];
+        if (option == "--samples") {
+            config.samples = max(1, parseNumericId(value, config.samples));
+        } else if (option == "--warmup") {
+            config.warmup = max(0, parseNumericId(value, config.warmup));
+        } else if (option == "--seed") {
+            config.seed = static_cast<uint32_t>(parseNumericId(value, static_cast<int>(config.seed)));
+        } else if (option == "--output") {
+            config.outputPath = value;
+        } else if (option == "--sizes") {
+            if (!parseSizeList(value, config.sizes)) {
+                cerr << "--sizes needs at least two row counts, e.g. 5k,10k,20k\n";
+                return false;
+            }
+        } else if (option == "--list-data") {
+            config.listDataPath = value;
+        } else if (option == "--array-data") {
+            config.arrayDataPath = value;
+        } else if (option == "--data-dir") {
+            config.dataDirectory = value;
+        } else if (option == "--baseline") {
+            config.baselinePath = value;
+        } else {
+            cerr << "Unknown option " << option << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+// Scaling mode: returns 1 when a curve regressed against the baseline
+int runScalingBenchmark(const BenchmarkConfig& config) {
+    vector<ScalingCurve> baseline;
+    if (!config.baselinePath.empty()) {
+        baseline = readScalingBaseline(config.baselinePath);
+        if (baseline.empty()) {
+            cerr << "No scaling curves in baseline '" << config.baselinePath << "'.\n";
+            return 2;
+        }
+    }
+
+    vector<ScalingPoint> points;
+    for (long long rows : config.sizes) {
+        cerr << "Measuring " << rows << " rows...\n";
+        ScalingPoint point;
+        if (!measureScalingPoint(config, rows, passengerLinkedList, unrolledPassengerList, point)) {
+            return 2;
+        }
+        points.push_back(point);
+    }
+
+    vector<ScalingCurve> curves = fitScalingCurves(points, baseline);
+    printScalingSummary(curves);
+    bool regressed = any_of(curves.begin(), curves.end(), [](const ScalingCurve& curve) { return curve.regression; });
+
+    if (config.outputPath.empty()) {
+        writeScalingReport(cout, config, points, curves);
+        return regressed ? 1 : 0;
+    }
+    ofstream out(config.outputPath);
+    if (!out.is_open()) {
+        cerr << "Could not open '" << config.outputPath << "' for writing.\n";
+        return 2;
+    }
+    writeScalingReport(out, config, points, curves);
+    return regressed ? 1 : 0;
+}
+
+// Loading a CSV that does not exist would create an empty one (and its
+// journal) in its place, so the headless run checks for it first
+bool requireDataFile(const string& path, const char* option) {
+    if (ifstream(path).is_open()) {
+        return true;
+    }
+    cerr << "Data file '" << path << "' not found. Pass it with " << option << " FILE.\n";
+    return false;
+}
+
+int main(int argc, char* argv[]) {
+    BenchmarkConfig config;
+    if (!parseBenchmarkArguments(argc, argv, config)) {
+        cerr << "Usage: benchmark [--list-data FILE] [--array-data FILE]\n"
+             << "                 [--samples N] [--warmup N] [--seed N] [--output FILE]\n"
+             << "       benchmark --scaling [--sizes 2500,5000,...] [--data-dir DIR] [--baseline FILE]\n"
+             << "                 [--samples N] [--warmup N] [--seed N] [--output FILE]\n";
+        return 2;
+    }
+    if (config.scaling) {
+        return runScalingBenchmark(config);
+    }
+
+    if (!config.listDataPath.empty()) {
+        usePassengerDataFile(config.listDataPath);
+    }
+    if (!config.arrayDataPath.empty()) {
+        useArrayDataFile(config.arrayDataPath);
+    }
+    if (!requireDataFile(csvFilePath, "--list-data") || !requireDataFile(CSV_FILE_PATH, "--array-data")) {
+        return 2;
+    }
+
+    LoadStats stats;
+    {
+        OutputSilencer silencer;
+        stats = loadAllData(passengerLinkedList, unrolledPassengerList);
+    }
+    // Nothing measured below may reach the data files
+    passengerJournal.close();
+    arrayJournal.close();
+
+    PassengerLinkedList& list = passengerLinkedList;
+    UnrolledPassengerList& unrolledList = unrolledPassengerList;
+    if (list.getSize() == 0 || unrolledList.getSize() == 0 || getTotalPassengers() == 0) {
+        cerr << "No passengers loaded (Linked List " << list.getSize() << ", Unrolled List " << unrolledList.getSize()
+             << ", Array " << getTotalPassengers() << "); timings on an empty fleet would be meaningless.\n";
+        return 2;
+    }
+    vector<BenchmarkResult> results = runOperationBenchmarks(config, list, unrolledList);
+
+    if (config.outputPath.empty()) {
+        writeBenchmarkReport(cout, config, stats, list, unrolledList, results);
+        return 0;
+    }
+    ofstream out(config.outputPath);
+    if (!out.is_open()) {
+        cerr << "Could not open '" << config.outputPath << "' for writing.\n";
+        return 1;
+    }
+    writeBenchmarkReport(out, config, stats, list, unrolledList, results);
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+===============================================================================
+PLANE FLIGHT RESERVATION SYSTEM - SYNTHETIC DATASET GENERATOR
+===============================================================================
+Component: Seeded passenger CSVs for scaling tests
+
+Writes manifests in the shipped PassengerID,Name,SeatRow,SeatColumn,Class
+schema at any size (see Shared/SyntheticFleetData.h for how rows are made).
+Sizes take a k/M suffix and may be listed together; each size gets its own
+file, SyntheticFleet_<size>.csv unless --output names one file.
+
+Build (from Source):  g++ -std=c++17 -O2 -o generate_fleet_data Benchmark/GenerateFleetData.cpp
+Usage:                generate_fleet_data [--rows 10k,100k,1M,10M] [--seed N]
+                                          [--collision-rate R] [--duplicate-rate R]
+                                          [--class-mix F,B,E] [--output FILE]
+
+Examples:
+  generate_fleet_data --rows 10k,100k,1M,10M
+  generate_fleet_data --rows 1M --collision-rate 0.2 --duplicate-rate 0.01 --class-mix 1,1,1
+===============================================================================
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../Shared/SyntheticFleetData.h"
+
+using namespace std;
+
+bool parseRate(const string& text, double& rate) {
+    char* end = nullptr;
+    rate = strtod(text.c_str(), &end);
+    return end != text.c_str() && *end == '\0' && rate >= 0.0 && rate <= 1.0;
+}
+
+vector<string> splitList(const string& text) {
+    vector<string> parts;
+    stringstream stream(text);
+    string part;
+    while (getline(stream, part, ',')) {
+        parts.push_back(part);
+    }
+    return parts;
+}
+
+void printUsage() {
+    cerr << "Usage: generate_fleet_data [--rows 10k,100k,1M,10M] [--seed N]\n"
+         << "                           [--collision-rate R] [--duplicate-rate R]\n"
+         << "                           [--class-mix F,B,E] [--output FILE]\n";
+}
+
+int main(int argc, char* argv[]) {
+    SyntheticFleetOptions options;
+    vector<string> sizeLabels = {"10k"};
+    string outputPath;
+
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        if (i + 1 >= argc) {
+            cerr << "Missing value for " << option << "\n";
+            printUsage();
+            return 2;
+        }
+        string value = argv[++i];
+        bool valid = true;
+        if (option == "--rows") {
+            sizeLabels = splitList(value);
+            valid = !sizeLabels.empty();
+            for (const string& label : sizeLabels) {
+                valid = valid && parseSyntheticRowCount(label) > 0;
+            }
+        } else if (option == "--seed") {
+            valid = !value.empty() && value.find_first_not_of("0123456789") == string::npos && value.size() <= 19;
+            if (valid) {
+                options.seed = stoull(value);
+            }
+        } else if (option == "--collision-rate") {
+            valid = parseRate(value, options.seatCollisionRate);
+        } else if (option == "--duplicate-rate") {
+            valid = parseRate(value, options.duplicateIdRate);
+        } else if (option == "--class-mix") {
+            vector<string> shares = splitList(value);
+            valid = shares.size() == SEAT_CLASS_COUNT;
+            double total = 0;
+            for (int seatClass = 0; valid && seatClass < SEAT_CLASS_COUNT; seatClass++) {
+                char* end = nullptr;
+                options.classMix[seatClass] = strtod(shares[seatClass].c_str(), &end);
+                valid = end != shares[seatClass].c_str() && *end == '\0' && options.classMix[seatClass] >= 0;
+                total += options.classMix[seatClass];
+            }
+            valid = valid && total > 0;
+        } else if (option == "--output") {
+            outputPath = value;
+        } else {
+            cerr << "Unknown option " << option << "\n";
+            valid = false;
+        }
+        if (!valid) {
+            cerr << "Invalid value '" << value << "' for " << option << "\n";
+            printUsage();
+            return 2;
+        }
+    }
+    if (!outputPath.empty() && sizeLabels.size() > 1) {
+        cerr << "--output names a single file, so give a single --rows size\n";
+        return 2;
+    }
+
+    for (const string& label : sizeLabels) {
+        options.rows = parseSyntheticRowCount(label);
+        string filePath = outputPath.empty() ? "SyntheticFleet_" + label + ".csv" : outputPath;
+
+        SyntheticFleetSummary summary;
+        auto start = chrono::steady_clock::now();
+        if (!writeSyntheticFleetCSV(filePath, options, summary)) {
+            cerr << "Could not write '" << filePath << "'\n";
+            return 1;
+        }
+        auto end = chrono::steady_clock::now();
+
+        cout << filePath << ": " << summary.rows << " rows, "
+             << summary.seatCollisions << " seat collisions, "
+             << summary.duplicateIds << " duplicate IDs, "
+             << "F/B/E " << summary.classRows[SEAT_CLASS_FIRST] << "/"
+             << summary.classRows[SEAT_CLASS_BUSINESS] << "/"
+             << summary.classRows[SEAT_CLASS_ECONOMY] << ", "
+             << summary.bytesWritten << " bytes in "
+             << chrono::duration<double, milli>(end - start).count() << " ms\n";
+    }
+    return 0;
+}
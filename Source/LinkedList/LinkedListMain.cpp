@@ -25,6 +25,18 @@ CODE ORGANIZATION:
 #include <algorithm>
 #include <cctype>
 #include <array>
+#include <vector>
+#include <climits>
+#include <atomic>
+
+#include "../Shared/MappedCSVReader.h"
+#include "../Shared/ParallelCSVScanner.h"
+#include "../Shared/SeatBitmap.h"
+#include "../Shared/FleetSeatOccupancy.h"
+#include "../Shared/FleetSnapshot.h"
+#include "../Shared/ReservationJournal.h"
+#include "../Shared/NodePool.h"
+#include "../Shared/PassengerIdSkipList.h"
 
 using namespace std;
 
@@ -32,8 +44,12 @@ using namespace std;
                  SECTION 1: SHARED/COMMON FUNCTIONS
    =========================================================== */
 
+// Data files (usePassengerDataFile points them at another CSV, e.g. a generated dataset)
+string csvFilePath = "C:\\Users\\User\\Dev\\C++\\Assignment-Data-Structure\\Source\\LinkedList\\FlightPassengerDataLinkedList.csv";
+string snapshotFilePath = fleetSnapshotPathFor(csvFilePath);
+string journalFilePath = reservationJournalPathFor(csvFilePath);
+
 // System constants
-const string csvFilePath = "C:\\Users\\User\\Dev\\C++\\Assignment-Data-Structure\\Source\\LinkedList\\FlightPassengerDataLinkedList.csv";
 const int totalRows = 30;
 const int totalColumns = 6;
 
@@ -46,6 +62,9 @@ struct SeatBookingInfo {
 
 SeatBookingInfo mostRecentBookings[totalRows][totalColumns];
 
+// Append-only log of reservations and cancellations since the CSV was last written
+ReservationJournal passengerJournal;
+
 struct PassengerCSV{
     string passengerID;
     string name;
@@ -72,14 +91,19 @@ struct PassengerNode {
     int planeNum;
     string passengerClass;
     PassengerNode* next;
+    PassengerNode* prev;
+    PassengerNode* nextInPlane; // Next passenger on the same plane (per-plane chain)
+    PassengerNode* prevInPlane;
+    uint64_t handleSerial;      // Unique per inserted node, so a stale handle is detected
 
     // ADD THIS DEFAULT CONSTRUCTOR
         PassengerNode() 
             : passengerId(""), passengerName(""), seatRow(0), seatColumn(0), 
-            planeNum(0), passengerClass(""), next(nullptr) {}
+            planeNum(0), passengerClass(""), next(nullptr), prev(nullptr),
+            nextInPlane(nullptr), prevInPlane(nullptr), handleSerial(0) {}
 
     // Constructor to initialize a passenger node with provided details.
-    PassengerNode(string id, string name, int row, int column, int planeNumber, string passengerClassType = "Economy") {
+    PassengerNode(const string& id, const string& name, int row, int column, int planeNumber, const string& passengerClassType = "Economy") {
         passengerId = id;
         passengerName = name;
         seatRow = row;
@@ -87,6 +111,33 @@ struct PassengerNode {
         passengerClass = passengerClassType;
         planeNum = planeNumber;
         next = nullptr;
+        prev = nullptr;
+        nextInPlane = nullptr;
+        prevInPlane = nullptr;
+        handleSerial = 0;
+    }
+};
+
+// Serials come from one counter for the whole process, not one per list: after
+// a reload (list = readPassengerCSV()) the new pool can reuse the old nodes'
+// addresses, and only a serial no list has issued before keeps old handles stale.
+inline uint64_t issueHandleSerial() {
+    static atomic<uint64_t> nextHandleSerial(1);
+    return nextHandleSerial.fetch_add(1, memory_order_relaxed);
+}
+
+// Stable reference to one passenger node, returned by inserts and lookups.
+// It stays valid until that passenger is removed; after that (even if the
+// node's memory is reused) the list recognises it as stale.
+struct PassengerHandle {
+    PassengerNode* node;
+    uint64_t serial;
+
+    PassengerHandle() : node(nullptr), serial(0) {}
+    PassengerHandle(PassengerNode* passengerNode, uint64_t handleSerial) : node(passengerNode), serial(handleSerial) {}
+
+    bool isEmpty() const {
+        return node == nullptr;
     }
 };
 
@@ -106,6 +157,87 @@ private:
     PassengerNode* tail;
     int totalPlanes;
 
+    // Every node lives in this pool's slabs and goes back to it when removed
+    NodePool<PassengerNode> nodePool;
+
+    // Seat bitmaps, free-seat tree, seat position index and running totals
+    FleetSeatOccupancy occupancy;
+
+    // Optional ordered index of the nodes by numeric passenger ID
+    PassengerIdSkipList<PassengerNode> idIndex;
+    bool idIndexEnabled;
+    int unindexedPassengers; // Nodes whose ID has no numeric key (never in idIndex)
+
+    // Plane directory: the chain of nodes on each plane number, linked through
+    // nextInPlane in list order, so one plane is read without walking the fleet
+    struct PlaneChain {
+        PassengerNode* head;
+        PassengerNode* tail;
+    };
+    vector<PlaneChain> planeChains;
+
+
+    void linkIntoPlane(PassengerNode* node) {
+        if (node->planeNum < 0) {
+            return;
+        }
+        if (node->planeNum >= static_cast<int>(planeChains.size())) {
+            planeChains.resize(node->planeNum + 1, PlaneChain{nullptr, nullptr});
+        }
+        PlaneChain& chain = planeChains[node->planeNum];
+        node->prevInPlane = chain.tail;
+        if (chain.head == nullptr) {
+            chain.head = node;
+        } else {
+            chain.tail->nextInPlane = node;
+        }
+        chain.tail = node;
+    }
+
+    void unlinkFromPlane(PassengerNode* node) {
+        if (node->planeNum < 0 || node->planeNum >= static_cast<int>(planeChains.size())) {
+            return;
+        }
+        PlaneChain& chain = planeChains[node->planeNum];
+        if (node->prevInPlane == nullptr) {
+            chain.head = node->nextInPlane;
+        } else {
+            node->prevInPlane->nextInPlane = node->nextInPlane;
+        }
+        if (node->nextInPlane == nullptr) {
+            chain.tail = node->prevInPlane;
+        } else {
+            node->nextInPlane->prevInPlane = node->prevInPlane;
+        }
+    }
+
+    // Unlinks a node from the list, its plane chain and the ID index, then
+    // releases it. Both neighbours are known from the node itself, so this is
+    // O(1) apart from the O(log n) index update.
+    void detachNode(PassengerNode* node) {
+        if (node->prev == nullptr) {
+            head = node->next;
+        } else {
+            node->prev->next = node->next;
+        }
+        if (node->next == nullptr) {
+            tail = node->prev;
+        } else {
+            node->next->prev = node->prev;
+        }
+
+        unlinkFromPlane(node);
+
+        uint64_t key = 0;
+        if (parsePassengerIdKey(node->passengerId, key)) {
+            idIndex.erase(key, node);
+        } else {
+            unindexedPassengers--;
+        }
+        occupancy.markSeat(node->seatRow, node->seatColumn, node->planeNum, false);
+        nodePool.release(node);
+    }
+
     // Helper function to render seating sections
     void renderSeatingRows(string sectionName, int startRow, int endRow, PassengerNode passengerList[30][6]) {
         cout << "---------- " << sectionName << " ----------" << endl;
@@ -129,61 +261,175 @@ public:
         head = nullptr;
         tail = nullptr;
         totalPlanes = 0;
+        idIndexEnabled = true;
+        unindexedPassengers = 0;
+    }
+
+    // The list owns its nodes through nodePool, so the whole list is torn down
+    // in one pass over the pool's slabs rather than node by node.
+    ~PassengerLinkedList() {
+        clear();
+    }
+
+    // Copying would share (and later double free) the nodes, so it is not allowed.
+    PassengerLinkedList(const PassengerLinkedList&) = delete;
+    PassengerLinkedList& operator=(const PassengerLinkedList&) = delete;
+
+    // Moving hands over the nodes and every side index; the source is left empty.
+    PassengerLinkedList(PassengerLinkedList&& other) noexcept
+        : head(other.head), tail(other.tail), totalPlanes(other.totalPlanes),
+          nodePool(move(other.nodePool)), occupancy(move(other.occupancy)), idIndex(move(other.idIndex)),
+          idIndexEnabled(other.idIndexEnabled), unindexedPassengers(other.unindexedPassengers),
+          planeChains(move(other.planeChains)) {
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.totalPlanes = 0;
+        other.occupancy.clear();
+        other.unindexedPassengers = 0;
+        other.planeChains.clear();
+    }
+
+    // Frees the current list first, so reloading (list = readPassengerCSV()) runs in constant memory.
+    PassengerLinkedList& operator=(PassengerLinkedList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            totalPlanes = other.totalPlanes;
+            nodePool = move(other.nodePool);
+            occupancy = move(other.occupancy);
+            idIndex = move(other.idIndex);
+            idIndexEnabled = other.idIndexEnabled;
+            unindexedPassengers = other.unindexedPassengers;
+            planeChains = move(other.planeChains);
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.totalPlanes = 0;
+            other.occupancy.clear();
+            other.unindexedPassengers = 0;
+            other.planeChains.clear();
+        }
+        return *this;
+    }
+
+    // Removes every passenger and releases all node memory at once.
+    void clear() {
+        nodePool.clear();
+        head = nullptr;
+        tail = nullptr;
+        totalPlanes = 0;
+        occupancy.clear();
+        idIndex.clear();
+        unindexedPassengers = 0;
+        planeChains.clear();
+        planeChains.shrink_to_fit();
     }
 
     PassengerNode* getHead() const {
         return head;
     }
 
-    void init(string id, string name, int row, int column, int planeNum, string passengerClassType = "Economy") {
-        PassengerNode* newNode = new PassengerNode(id, name, row, column, planeNum, passengerClassType);
+    // Appends a passenger and returns a handle to its node.
+    PassengerHandle init(const string& id, const string& name, int row, int column, int planeNum, const string& passengerClassType = "Economy") {
+        PassengerNode* newNode = nodePool.allocate(id, name, row, column, planeNum, passengerClassType);
+        newNode->handleSerial = issueHandleSerial();
+        occupancy.markSeat(row, column, planeNum, true);
+        linkIntoPlane(newNode);
+
+        uint64_t key = 0;
+        if (!parsePassengerIdKey(id, key)) {
+            unindexedPassengers++;
+        } else if (idIndexEnabled) {
+            idIndex.insert(key, newNode);
+        }
 
+        newNode->prev = tail;
         if (head == nullptr) {
             head = newNode;
-            tail = newNode;
-            return;
+        } else {
+            tail->next = newNode;
         }
-
-        tail->next = newNode;
         tail = newNode;
+        return PassengerHandle(newNode, newNode->handleSerial);
     }
 
-    int getSize() {
-        int count = 0;
+    // Every insert appends, so the newest passenger is always the tail
+    PassengerHandle getLastInsertedHandle() const {
+        if (tail == nullptr) {
+            return PassengerHandle();
+        }
+        return PassengerHandle(tail, tail->handleSerial);
+    }
 
-        PassengerNode* current = head;
-        
-        while (current != nullptr) {
-            count++;
-            current = current-> next;
+    // The node behind a handle, or nullptr once that passenger has been removed
+    PassengerNode* resolve(const PassengerHandle& handle) const {
+        if (handle.isEmpty() || !nodePool.isLive(handle.node) || handle.node->handleSerial != handle.serial) {
+            return nullptr;
         }
-        return count;
+        return handle.node;
     }
 
-    bool doesPassengerExists(string id) {
-        PassengerNode* current = head;
+    // Handle of the first passenger with this ID (empty when there is none)
+    PassengerHandle findPassengerHandle(const string& id) {
+        PassengerNode* node = searchPassenger(id);
+        if (node == nullptr) {
+            return PassengerHandle();
+        }
+        return PassengerHandle(node, node->handleSerial);
+    }
 
-        while (current != nullptr) {
-            if (current->passengerId == id) {
-                return true;
+    // Removes the passenger behind a handle without searching for it.
+    bool removePassenger(const PassengerHandle& handle, PassengerNode& removedPassenger) {
+        PassengerNode* node = resolve(handle);
+        if (node == nullptr) {
+            return false;
+        }
+        removedPassenger = *node;
+        removedPassenger.next = nullptr;
+        removedPassenger.prev = nullptr;
+        removedPassenger.nextInPlane = nullptr;
+        removedPassenger.prevInPlane = nullptr;
+        detachNode(node);
+        return true;
+    }
+
+    // Every node is a live allocation in the pool, so its count is the list size.
+    int getSize() const {
+        return static_cast<int>(nodePool.size());
+    }
+
+    const FleetStatistics& getStatistics() const {
+        return occupancy.getStatistics();
+    }
+
+    // Turning the index on builds it from the current nodes in list order, so
+    // equal IDs keep the order a scan would find them in.
+    void setIdIndexEnabled(bool enabled) {
+        idIndex.clear();
+        idIndexEnabled = enabled;
+        if (!enabled) {
+            return;
+        }
+        for (PassengerNode* current = head; current != nullptr; current = current->next) {
+            uint64_t key = 0;
+            if (parsePassengerIdKey(current->passengerId, key)) {
+                idIndex.insert(key, current);
             }
-            current = current->next;
         }
+    }
 
-        return false;
+    bool isIdIndexEnabled() const {
+        return idIndexEnabled;
+    }
+
+    bool doesPassengerExists(string id) {
+        return searchPassenger(id) != nullptr;
     }
 
     // Check if a specific seat on a plane is occupied.
+    // Answered from the per-plane seat bitmap instead of walking the list.
     bool isSeatOccupied(int seatRow, int columnChar, int planeNumber) {
-        PassengerNode* current = head;
-        
-        while (current != nullptr) {
-            if (current->seatRow == seatRow && current->seatColumn == columnChar && current->planeNum == planeNumber) {
-                return true;
-            }
-            current = current->next;
-        }
-        return false;
+        return occupancy.isSeatOccupied(seatRow, columnChar, planeNumber);
     }
 
     // Display all the information about the passengers in the whole dataset with optional class filter
@@ -241,17 +487,43 @@ public:
             }
         }
 
-        PassengerNode* current = head;
-        while (current != nullptr) {
-            if (current->planeNum == planeNumber) {
-                passengerList[current->seatRow][current->seatColumn] = *current;
+        // Only this plane's chain is walked, not the whole fleet
+        for (PassengerNode* current = getPlaneHead(planeNumber); current != nullptr; current = current->nextInPlane) {
+            passengerList[current->seatRow][current->seatColumn] = *current;
+        }
+    }
+
+    // First node of a plane's chain (follow nextInPlane), or nullptr for an empty plane
+    PassengerNode* getPlaneHead(int planeNumber) const {
+        if (planeNumber < 0 || planeNumber >= static_cast<int>(planeChains.size())) {
+            return nullptr;
+        }
+        return planeChains[planeNumber].head;
+    }
+
+    // The passenger in one seat of one plane, found on that plane's chain
+    PassengerNode* getPassengerInSeat(int planeNumber, int seatRow, int seatColumn) const {
+        if (!occupancy.isSeatOccupied(seatRow, seatColumn, planeNumber)) {
+            return nullptr;
+        }
+        for (PassengerNode* current = getPlaneHead(planeNumber); current != nullptr; current = current->nextInPlane) {
+            if (current->seatRow == seatRow && current->seatColumn == seatColumn) {
+                return current;
             }
-            current = current->next;
         }
+        return nullptr;
     }
 
-    // Search for a passenger by ID
+    // Search for a passenger by ID. Numeric IDs are answered by the skip list
+    // in O(log n); anything else falls back to walking the list.
     PassengerNode* searchPassenger(string id) {
+        uint64_t key = 0;
+        if (idIndexEnabled && parsePassengerIdKey(id, key)) {
+            return idIndex.find(key, [&](const PassengerNode* node) {
+                return node->passengerId == id;
+            });
+        }
+
         PassengerNode* current = head;
         while (current != nullptr) {
             if (current->passengerId == id) {
@@ -262,6 +534,31 @@ public:
         return nullptr;
     }
 
+    // Calls visit(node) for every passenger whose numeric ID lies in
+    // [firstId, lastId], in ID order (equal IDs in list order). Without the
+    // index this has to collect and sort the whole list.
+    template <typename Visitor>
+    void forEachPassengerInIdRange(uint64_t firstId, uint64_t lastId, Visitor visit) {
+        if (idIndexEnabled) {
+            idIndex.forEachInRange(firstId, lastId, visit);
+            return;
+        }
+
+        vector<pair<uint64_t, PassengerNode*>> matches;
+        for (PassengerNode* current = head; current != nullptr; current = current->next) {
+            uint64_t key = 0;
+            if (parsePassengerIdKey(current->passengerId, key) && key >= firstId && key <= lastId) {
+                matches.emplace_back(key, current);
+            }
+        }
+        stable_sort(matches.begin(), matches.end(), [](const pair<uint64_t, PassengerNode*>& a, const pair<uint64_t, PassengerNode*>& b) {
+            return a.first < b.first;
+        });
+        for (const pair<uint64_t, PassengerNode*>& match : matches) {
+            visit(match.second);
+        }
+    }
+
     // Display seating grid and manifest for a specific plane
     void displayPlaneManifest(int planeNumber) {
         PassengerNode passengerList[30][6];
@@ -299,14 +596,44 @@ public:
 
     void setTotalPlanes(int total) {
         totalPlanes = total;
+        occupancy.ensurePlanes(total);
+    }
+
+    // Seat searches used by the reservation logic, answered by the side indexes
+    int findFirstPlaneWithSeatFree(int seatRow, int seatColumn) {
+        return occupancy.findFirstPlaneWithSeatFree(seatRow, seatColumn);
+    }
+
+    vector<int> getPlanesWithSeatOccupied(int seatRow, int seatColumn) {
+        return occupancy.getPlanesWithSeatOccupied(seatRow, seatColumn);
+    }
+
+    int findFirstPlaneWithFreeSeat(int seatClass, int maxPlaneNumber) {
+        return occupancy.findFirstPlaneWithFreeSeat(seatClass, maxPlaneNumber);
     }
 
-    int getTotalPlanes() {
+    bool findFirstFreeSeat(int planeNumber, int seatClass, int& seatRow, int& seatColumn) {
+        return occupancy.findFirstFreeSeat(planeNumber, seatClass, seatRow, seatColumn);
+    }
+
+    int getTotalPlanes() const {
         return totalPlanes;
     }
 
     string getNextPassengerId() {
         int highestPassengerId = 110000;
+
+        // With every ID indexed, the largest one sits at the end of the skip list
+        if (idIndexEnabled && unindexedPassengers == 0) {
+            uint64_t largestKey = 0;
+            if (!idIndex.maxKey(largestKey)) {
+                return to_string(highestPassengerId + 1);
+            }
+            if (largestKey < static_cast<uint64_t>(INT_MAX)) {
+                return to_string(max(largestKey, static_cast<uint64_t>(highestPassengerId)) + 1);
+            }
+        }
+
         PassengerNode* currentPassenger = head;
 
         while (currentPassenger != nullptr) {
@@ -331,42 +658,9 @@ public:
         return to_string(highestPassengerId + 1);
     }
 
+    // Looks the passenger up (O(log n) for numeric IDs), then unlinks the node in O(1).
     bool removePassengerById(const string& passengerId, PassengerNode& removedPassenger) {
-        if (head == nullptr) {
-            return false;
-        }
-
-        if (head->passengerId == passengerId) {
-            PassengerNode* removedNode = head;
-            removedPassenger = *removedNode;
-            removedPassenger.next = nullptr;
-            head = head->next;
-            if (removedNode == tail) {
-                tail = head;
-            }
-            delete removedNode;
-            return true;
-        }
-
-        PassengerNode* previous = head;
-        PassengerNode* current = head->next;
-
-        while (current != nullptr) {
-            if (current->passengerId == passengerId) {
-                removedPassenger = *current;
-                removedPassenger.next = nullptr;
-                previous->next = current->next;
-                if (current == tail) {
-                    tail = previous;
-                }
-                delete current;
-                return true;
-            }
-            previous = current;
-            current = current->next;
-        }
-
-        return false;
+        return removePassenger(findPassengerHandle(passengerId), removedPassenger);
     }
 
     void writeToCSV(const string& filePath) const {
@@ -376,7 +670,7 @@ public:
             return;
         }
 
-        csvOutputFile << "PassengerID,Name,SeatRow,SeatColumn,Class" << endl;
+        csvOutputFile << "PassengerID,Name,SeatRow,SeatColumn,Class\n";
 
         PassengerNode* currentPassenger = head;
         while (currentPassenger != nullptr) {
@@ -384,7 +678,7 @@ public:
                          << currentPassenger->passengerName << ","
                          << (currentPassenger->seatRow + 1) << ","
                          << PassengerconvertColumnIndexToChar(currentPassenger->seatColumn) << ","
-                         << currentPassenger->passengerClass << endl;
+                         << currentPassenger->passengerClass << '\n';
             currentPassenger = currentPassenger->next;
         }
 
@@ -393,71 +687,128 @@ public:
 
 };
 
-PassengerLinkedList readPassengerCSV() {
-    ifstream csvInputFile(csvFilePath);
-    PassengerLinkedList passengerLinkedList;
+// Reads and writes dataFilePath (and the snapshot and journal next to it) from
+// now on. The Unrolled List loads from the same files.
+void usePassengerDataFile(const string& dataFilePath) {
+    csvFilePath = dataFilePath;
+    snapshotFilePath = fleetSnapshotPathFor(dataFilePath);
+    journalFilePath = reservationJournalPathFor(dataFilePath);
+}
 
-    if (!csvInputFile.is_open()) {
-        cout << "Could not open the file: " << csvFilePath << endl;
-        return passengerLinkedList;
+// Rebuilds the list from the binary snapshot. Returns false (leaving the list
+// untouched) when there is no snapshot or the CSV has changed since it was written.
+// Templated over the list type so the unrolled list loads from the same file.
+template <typename PassengerList>
+bool readPassengerSnapshot(PassengerList& passengerLinkedList) {
+    FleetSnapshotReader snapshot;
+    if (!snapshot.open(snapshotFilePath, csvFilePath)) {
+        return false;
     }
 
-    const size_t fileBufferSize = 1 << 20;
-    static char fileBuffer[fileBufferSize];
-    csvInputFile.rdbuf()->pubsetbuf(fileBuffer, fileBufferSize);
-
-    // Initializing the mostRecentBookings array to all seats available
-    for (int rowIndex =0; rowIndex < totalRows; rowIndex++){
-        for (int columnIndex=0; columnIndex < totalColumns; columnIndex++) {
-            mostRecentBookings[rowIndex][columnIndex].isOccupied = false;
-        }
+    // Every node already carries its resolved plane, so there is no seat search here
+    string passengerId;
+    string passengerName;
+    string passengerClass;
+    for (int i = 0; i < snapshot.getRecordCount(); i++) {
+        const FleetSnapshotRecord& record = snapshot.getRecord(i);
+        passengerId.assign(snapshot.getString(record.passengerIdRef));
+        passengerName.assign(snapshot.getString(record.passengerNameRef));
+        passengerClass.assign(snapshot.getString(record.passengerClassRef));
+        passengerLinkedList.init(passengerId, passengerName, record.seatSlot / totalColumns,
+                                 record.seatSlot % totalColumns, record.planeNumber, passengerClass);
     }
+    passengerLinkedList.setTotalPlanes(snapshot.getPlaneCount());
+    return true;
+}
 
-    string currentLine;
-    int totalRecordsRead = 0;
-    int currentPlaneIndex = 1;
-    int newPlaneIndex = currentPlaneIndex;
-    int totalPlanes = -11111;
+// Writes the list to the binary snapshot in list order, stamped with the current CSV.
+bool savePassengerSnapshot(const PassengerLinkedList& passengerLinkedList) {
+    FleetSnapshotWriter snapshot;
+    for (PassengerNode* current = passengerLinkedList.getHead(); current != nullptr; current = current->next) {
+        snapshot.addRecord(current->passengerId, current->passengerName, current->passengerClass,
+                           current->planeNum, seatSlotIndex(current->seatRow, current->seatColumn));
+    }
+    return snapshot.writeFile(snapshotFilePath, csvFilePath, max(passengerLinkedList.getTotalPlanes(), 0));
+}
 
-    // Skip the header line
-    getline(csvInputFile, currentLine);
+// Re-applies the reservations and cancellations made since the CSV was last
+// written. Only reads the journal, so any list type can be brought up to date.
+template <typename PassengerList>
+int applyPassengerJournal(PassengerList& passengerLinkedList) {
+    string passengerId;
+    string passengerName;
+    string passengerClass;
 
-    while (getline(csvInputFile, currentLine)) {
-        size_t firstCommaIndex = currentLine.find(',');
-        if (firstCommaIndex == string::npos) {
-            continue;
+    int entriesReplayed = replayReservationJournal(journalFilePath, csvFilePath, [&](const ReservationJournalEntry& entry) {
+        passengerId.assign(entry.passenger.passengerId);
+        if (entry.operation == JOURNAL_CANCELLATION) {
+            PassengerNode removedPassenger;
+            passengerLinkedList.removePassengerById(passengerId, removedPassenger);
+            return;
         }
 
-        size_t secondCommaIndex = currentLine.find(',', firstCommaIndex + 1);
-        if (secondCommaIndex == string::npos) {
-            continue;
+        int seatRow = entry.passenger.seatRow - 1;
+        int seatColumn = convertColumnCharToIndex(entry.passenger.seatColumnLetter);
+        if (seatSlotIndex(seatRow, seatColumn) < 0) {
+            return;
         }
 
-        size_t thirdCommaIndex = currentLine.find(',', secondCommaIndex + 1);
-        if (thirdCommaIndex == string::npos) {
-            continue;
+        // The plane was already chosen when the reservation was made
+        passengerName.assign(entry.passenger.passengerName);
+        passengerClass.assign(entry.passenger.passengerClass);
+        passengerLinkedList.init(passengerId, passengerName, seatRow, seatColumn, entry.planeNumber, passengerClass);
+        if (entry.planeNumber > passengerLinkedList.getTotalPlanes()) {
+            passengerLinkedList.setTotalPlanes(entry.planeNumber);
         }
+    });
+    return entriesReplayed;
+}
+
+// Replays the journal into the list, then reopens it for appending.
+int replayPassengerJournal(PassengerLinkedList& passengerLinkedList) {
+    int entriesReplayed = applyPassengerJournal(passengerLinkedList);
+    passengerJournal.resume(journalFilePath, csvFilePath, entriesReplayed);
+    return entriesReplayed;
+}
 
-        size_t fourthCommaIndex = currentLine.find(',', thirdCommaIndex + 1);
-        if (fourthCommaIndex == string::npos) {
-            continue;
+// Parses the CSV and places every row on the first plane where its seat is
+// free. Returns false when the file cannot be opened; csvMissing (if given)
+// then says whether that was because the file does not exist.
+template <typename PassengerList>
+bool placePassengerCSVRows(PassengerList& passengerLinkedList, bool* csvMissing = nullptr) {
+    MappedFile csvInputFile;
+    if (!csvInputFile.open(csvFilePath)) {
+        cout << "Could not open the file: " << csvFilePath << endl;
+        if (csvMissing != nullptr) {
+            *csvMissing = csvInputFile.isMissing();
         }
+        return false;
+    }
 
-        string passengerId = currentLine.substr(0, firstCommaIndex);
-        string passengerName = currentLine.substr(firstCommaIndex + 1, secondCommaIndex - firstCommaIndex - 1);
-        string seatRowString = currentLine.substr(secondCommaIndex + 1, thirdCommaIndex - secondCommaIndex - 1);
-        string seatColumnString = currentLine.substr(thirdCommaIndex + 1, fourthCommaIndex - thirdCommaIndex - 1);
-        string passengerClass = currentLine.substr(fourthCommaIndex + 1);
+    int currentPlaneIndex = 1;
+    int newPlaneIndex = currentPlaneIndex;
+    int totalPlanes = -11111;
+
+    // These buffers are reused for every row instead of making substr copies
+    string passengerId;
+    string passengerName;
+    string passengerClass;
+
+    // The header line is skipped by the scanner
+    scanPassengerCSVParallel(csvInputFile.contents(), [&](const PassengerCSVRecord& record) {
+        passengerId.assign(record.passengerId);
+        passengerName.assign(record.passengerName);
+        passengerClass.assign(record.passengerClass);
 
         // Convert seat row to int and making it as index
-        int seatRow = stoi(seatRowString) - 1;
-        int seatColumn = convertColumnCharToIndex(seatColumnString[0]);
+        int seatRow = record.seatRow - 1;
+        int seatColumn = convertColumnCharToIndex(record.seatColumnLetter);
 
         // This will check whether is already someone in that seat
-        // if there is then the algorithm will keep on increasing the plane index
-        // until the seat on the plane is free
-        while (passengerLinkedList.isSeatOccupied(seatRow, seatColumn, newPlaneIndex)) {
-            newPlaneIndex++;
+        // if there is then the algorithm moves on to the next plane index
+        // until the seat on the plane is free (one word-level scan of the seat index)
+        if (passengerLinkedList.isSeatOccupied(seatRow, seatColumn, newPlaneIndex)) {
+            newPlaneIndex = passengerLinkedList.findFirstPlaneWithSeatFree(seatRow, seatColumn);
         }
 
         // Just to see how many planes are there in total
@@ -467,16 +818,64 @@ PassengerLinkedList readPassengerCSV() {
         // Initializing the data of the linked list
         passengerLinkedList.init(passengerId, passengerName, seatRow, seatColumn, newPlaneIndex, passengerClass);
         newPlaneIndex = currentPlaneIndex;
-       
-    }
-    csvInputFile.close();
+        return true;
+    });
     passengerLinkedList.setTotalPlanes(totalPlanes);
-
-    return passengerLinkedList;
+    return true;
 }
 
+// Full rewrite (compaction): the CSV now holds everything the journal did,
+// so the snapshot is restamped and the journal starts over empty.
 void savePassengerCSV(const PassengerLinkedList& passengerLinkedList) {
     passengerLinkedList.writeToCSV(csvFilePath);
+    savePassengerSnapshot(passengerLinkedList);
+    passengerJournal.start(journalFilePath, csvFilePath);
+}
+
+PassengerLinkedList readPassengerCSV() {
+    PassengerLinkedList passengerLinkedList;
+
+    // Rows read back while loading are already on disk, so they are not journaled
+    passengerJournal.close();
+
+    // Initializing the mostRecentBookings array to all seats available
+    for (int rowIndex =0; rowIndex < totalRows; rowIndex++){
+        for (int columnIndex=0; columnIndex < totalColumns; columnIndex++) {
+            mostRecentBookings[rowIndex][columnIndex].isOccupied = false;
+        }
+    }
+
+    // A snapshot that is still in step with the CSV skips parsing and seat placement
+    if (readPassengerSnapshot(passengerLinkedList)) {
+        replayPassengerJournal(passengerLinkedList);
+        return passengerLinkedList;
+    }
+
+    bool csvMissing = false;
+    if (!placePassengerCSVRows(passengerLinkedList, &csvMissing)) {
+        if (!csvMissing) {
+            // The file is there but unreadable; writing it would wipe the data
+            cout << "The file was left untouched. Bookings will not be saved." << endl;
+            return passengerLinkedList;
+        }
+        // Create the file (header only) and start the journal against it, so
+        // bookings made from here on are recorded instead of silently dropped
+        savePassengerCSV(passengerLinkedList);
+        return passengerLinkedList;
+    }
+    savePassengerSnapshot(passengerLinkedList);
+    replayPassengerJournal(passengerLinkedList);
+
+    return passengerLinkedList;
+}
+
+// Group-commits the journal after a change and compacts it into the CSV
+// once enough records have built up.
+void commitPassengerJournal(const PassengerLinkedList& passengerLinkedList) {
+    passengerJournal.commit();
+    if (passengerJournal.isCompactionDue()) {
+        savePassengerCSV(passengerLinkedList);
+    }
 }
 
 /* ===========================================================
@@ -489,6 +888,7 @@ struct ReservationInsertionResult {
     int planeNumber;
     int seatRowIndex;
     int seatColumnIndex;
+    PassengerHandle passengerHandle; // Set by insertPassengerReservation (Linked List only)
 };
 
 struct ReservationDeletionResult {
@@ -562,8 +962,11 @@ string generateNextPassengerId(PassengerLinkedList& linkedList) {
     return linkedList.getNextPassengerId();
 }
 
-ReservationInsertionResult insertPassengerReservation(
-    PassengerLinkedList& linkedList,
+// Validates the request and seats the passenger. Templated over the list type,
+// so every list backend makes exactly the same placement decisions.
+template <typename PassengerList>
+ReservationInsertionResult placePassengerReservation(
+    PassengerList& linkedList,
     const string& passengerId,
     const string& passengerName,
     const string& passengerClassInput,
@@ -644,15 +1047,14 @@ ReservationInsertionResult insertPassengerReservation(
             return result;
         }
 
-        for (int planeNumber = 1; planeNumber <= totalPlanes; planeNumber++) {
-            if (!linkedList.isSeatOccupied(preferredSeatRowIndex, preferredSeatColumnIndex, planeNumber)) {
-                linkedList.init(passengerId, passengerName, preferredSeatRowIndex, preferredSeatColumnIndex, planeNumber, normalizedClass);
-                result.isSuccessful = true;
-                result.planeNumber = planeNumber;
-                result.seatRowIndex = preferredSeatRowIndex;
-                result.seatColumnIndex = preferredSeatColumnIndex;
-                return result;
-            }
+        int planeNumber = linkedList.findFirstPlaneWithSeatFree(preferredSeatRowIndex, preferredSeatColumnIndex);
+        if (planeNumber <= totalPlanes) {
+            linkedList.init(passengerId, passengerName, preferredSeatRowIndex, preferredSeatColumnIndex, planeNumber, normalizedClass);
+            result.isSuccessful = true;
+            result.planeNumber = planeNumber;
+            result.seatRowIndex = preferredSeatRowIndex;
+            result.seatColumnIndex = preferredSeatColumnIndex;
+            return result;
         }
 
         int newPlaneNumber = totalPlanes + 1;
@@ -665,19 +1067,18 @@ ReservationInsertionResult insertPassengerReservation(
         return result;
     }
 
-    for (int planeNumber = 1; planeNumber <= totalPlanes; planeNumber++) {
-        for (int rowIndex = startRowIndex; rowIndex <= endRowIndex; rowIndex++) {
-            for (int columnIndex = 0; columnIndex < totalColumns; columnIndex++) {
-                if (!linkedList.isSeatOccupied(rowIndex, columnIndex, planeNumber)) {
-                    linkedList.init(passengerId, passengerName, rowIndex, columnIndex, planeNumber, normalizedClass);
-                    result.isSuccessful = true;
-                    result.planeNumber = planeNumber;
-                    result.seatRowIndex = rowIndex;
-                    result.seatColumnIndex = columnIndex;
-                    return result;
-                }
-            }
-        }
+    // The free-seat tree points straight at the first plane with room in this class
+    int seatClass = seatClassIndex(normalizedClass);
+    int firstFreePlane = linkedList.findFirstPlaneWithFreeSeat(seatClass, totalPlanes);
+    int rowIndex = 0;
+    int columnIndex = 0;
+    if (firstFreePlane > 0 && linkedList.findFirstFreeSeat(firstFreePlane, seatClass, rowIndex, columnIndex)) {
+        linkedList.init(passengerId, passengerName, rowIndex, columnIndex, firstFreePlane, normalizedClass);
+        result.isSuccessful = true;
+        result.planeNumber = firstFreePlane;
+        result.seatRowIndex = rowIndex;
+        result.seatColumnIndex = columnIndex;
+        return result;
     }
 
     int newPlaneNumber = totalPlanes + 1;
@@ -692,14 +1093,37 @@ ReservationInsertionResult insertPassengerReservation(
     return result;
 }
 
+// Places the reservation and journals it. The journal records the resolved
+// plane and seat, so replaying it never has to repeat the search.
+ReservationInsertionResult insertPassengerReservation(
+    PassengerLinkedList& linkedList,
+    const string& passengerId,
+    const string& passengerName,
+    const string& passengerClassInput,
+    bool hasPreferredSeat,
+    int preferredSeatRowIndex,
+    int preferredSeatColumnIndex,
+    int forcedPlaneNumber = -1
+) {
+    ReservationInsertionResult result = placePassengerReservation(
+        linkedList, passengerId, passengerName, passengerClassInput,
+        hasPreferredSeat, preferredSeatRowIndex, preferredSeatColumnIndex, forcedPlaneNumber
+    );
+    if (result.isSuccessful) {
+        result.passengerHandle = linkedList.getLastInsertedHandle();
+        string normalizedClass;
+        normalizePassengerClass(passengerClassInput, normalizedClass);
+        passengerJournal.appendReservation(passengerId, passengerName, normalizedClass,
+                                           result.planeNumber, result.seatRowIndex, result.seatColumnIndex);
+    }
+    return result;
+}
+
 /* ===========================================================
         SECTION 3: TP082578 - CANCELLATION (DELETION)
    =========================================================== */
 
-ReservationDeletionResult deletePassengerReservation(
-    PassengerLinkedList& linkedList,
-    const string& passengerId
-) {
+ReservationDeletionResult emptyDeletionResult() {
     ReservationDeletionResult result{};
     result.isSuccessful = false;
     result.errorMessage = "";
@@ -709,6 +1133,28 @@ ReservationDeletionResult deletePassengerReservation(
     result.planeNumber = -1;
     result.seatRowIndex = -1;
     result.seatColumnIndex = -1;
+    return result;
+}
+
+ReservationDeletionResult describeRemovedPassenger(const PassengerNode& removedPassenger) {
+    ReservationDeletionResult result = emptyDeletionResult();
+    result.isSuccessful = true;
+    result.passengerId = removedPassenger.passengerId;
+    result.passengerName = removedPassenger.passengerName;
+    result.passengerClass = removedPassenger.passengerClass;
+    result.planeNumber = removedPassenger.planeNum;
+    result.seatRowIndex = removedPassenger.seatRow;
+    result.seatColumnIndex = removedPassenger.seatColumn;
+    return result;
+}
+
+// Unlinks the passenger and reports what was removed (shared by the list backends).
+template <typename PassengerList>
+ReservationDeletionResult removePassengerReservation(
+    PassengerList& linkedList,
+    const string& passengerId
+) {
+    ReservationDeletionResult result = emptyDeletionResult();
 
     if (!hasNonWhitespaceContent(passengerId)) {
         result.errorMessage = "Passenger ID cannot be empty.";
@@ -720,21 +1166,72 @@ ReservationDeletionResult deletePassengerReservation(
         result.errorMessage = "Passenger ID not found.";
         return result;
     }
+    return describeRemovedPassenger(removedPassenger);
+}
 
-    result.isSuccessful = true;
-    result.passengerId = removedPassenger.passengerId;
-    result.passengerName = removedPassenger.passengerName;
-    result.passengerClass = removedPassenger.passengerClass;
-    result.planeNumber = removedPassenger.planeNum;
-    result.seatRowIndex = removedPassenger.seatRow;
-    result.seatColumnIndex = removedPassenger.seatColumn;
-    return result;
+// Cancels through a handle from an earlier insert or lookup, so no search is
+// needed: the node is unlinked in constant time and the cancellation journaled.
+ReservationDeletionResult deletePassengerReservation(
+    PassengerLinkedList& linkedList,
+    const PassengerHandle& passengerHandle
+) {
+    PassengerNode removedPassenger;
+    if (!linkedList.removePassenger(passengerHandle, removedPassenger)) {
+        ReservationDeletionResult result = emptyDeletionResult();
+        result.errorMessage = "Passenger reservation no longer exists.";
+        return result;
+    }
+
+    passengerJournal.appendCancellation(removedPassenger.passengerId);
+    return describeRemovedPassenger(removedPassenger);
+}
+
+// Cancels by passenger ID: one lookup for the handle, then the constant-time removal.
+ReservationDeletionResult deletePassengerReservation(
+    PassengerLinkedList& linkedList,
+    const string& passengerId
+) {
+    if (!hasNonWhitespaceContent(passengerId)) {
+        ReservationDeletionResult result = emptyDeletionResult();
+        result.errorMessage = "Passenger ID cannot be empty.";
+        return result;
+    }
+
+    PassengerHandle passengerHandle = linkedList.findPassengerHandle(passengerId);
+    if (passengerHandle.isEmpty()) {
+        ReservationDeletionResult result = emptyDeletionResult();
+        result.errorMessage = "Passenger ID not found.";
+        return result;
+    }
+    return deletePassengerReservation(linkedList, passengerHandle);
 }
 
 /* ===========================================================
           SECTION 4: TP081462 - SEAT LOOKUP FUNCTIONS
    =========================================================== */
 
+// Writes the passengers with IDs in [firstId, lastId] to a CSV in ID order
+// (same columns as the data file), e.g. for an audit of one booking batch.
+// Returns the number of passengers written, or -1 when the file cannot be opened.
+int exportPassengerIdRange(PassengerLinkedList& linkedList, uint64_t firstId, uint64_t lastId, const string& filePath) {
+    ofstream auditFile(filePath);
+    if (!auditFile.is_open()) {
+        return -1;
+    }
+
+    auditFile << "PassengerID,Name,SeatRow,SeatColumn,Class\n";
+    int exported = 0;
+    linkedList.forEachPassengerInIdRange(firstId, lastId, [&](const PassengerNode* passenger) {
+        auditFile << passenger->passengerId << ","
+                  << passenger->passengerName << ","
+                  << (passenger->seatRow + 1) << ","
+                  << PassengerconvertColumnIndexToChar(passenger->seatColumn) << ","
+                  << passenger->passengerClass << '\n';
+        exported++;
+    });
+    return exported;
+}
+
 // Setting up the global variables
 PassengerLinkedList passengerLinkedList;
 const char availableSeatMarker = 'O';
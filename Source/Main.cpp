@@ -3,6 +3,9 @@
 #include <string>
 #include <chrono>
 #include <sstream>
+#include <vector>
+#include <algorithm>
+#include <thread>
 
 using namespace std;
 
@@ -11,6 +14,11 @@ using namespace std;
 #undef main
 
 #include "LinkedList/LinkedListMain.cpp"
+#include "UnrolledList/UnrolledListMain.cpp"
+
+// Replaces operator new / delete for the whole program; include it nowhere else
+#include "Shared/MemoryAccounting.h"
+#include "Shared/HardwareCounters.h"
 
 struct UILines {
     string lines[100];
@@ -32,8 +40,14 @@ struct SeatGrid {
 struct LoadStats {
     double arrayLoadMs;
     double linkedListLoadMs;
+    double unrolledListLoadMs;
+    double wallMs; // All loads together (the Array loads alongside the lists)
+    HardwareCounterReading arrayCounters;
+    HardwareCounterReading linkedListCounters;
+    HardwareCounterReading unrolledListCounters;
     bool arrayLoaded;
     bool linkedListLoaded;
+    bool unrolledListLoaded;
 };
 
 string formatBytes(size_t bytes) {
@@ -60,22 +74,91 @@ string formatBytes(size_t bytes) {
     return out.str();
 }
 
+// "1.52 MB in 10234 blocks (96.3 B/passenger)" - measured heap held by one backend
+string formatMeasuredMemory(MemoryTag tag, int passengerCount) {
+    MemoryUsage usage = readMemoryUsage(tag);
+    ostringstream out;
+    out << formatBytes(usage.liveBytes) << " in " << usage.liveBlocks << " blocks";
+    if (passengerCount > 0) {
+        out << " (" << fixed << setprecision(1)
+            << static_cast<double>(usage.liveBytes) / passengerCount << " B/passenger)";
+    }
+    return out.str();
+}
+
+// "1.52 MB in 10234 blocks (+208 B / +1 blocks)" - measured heap of one
+// backend after an operation, and how much the operation changed it
+string formatMemoryChange(const MemoryUsage& before, const MemoryUsage& after) {
+    bool grew = after.liveBytes >= before.liveBytes;
+    size_t byteChange = grew ? after.liveBytes - before.liveBytes : before.liveBytes - after.liveBytes;
+    long long blockChange = static_cast<long long>(after.liveBlocks) - static_cast<long long>(before.liveBlocks);
+    ostringstream out;
+    out << formatBytes(after.liveBytes) << " in " << after.liveBlocks << " blocks ("
+        << (grew ? "+" : "-") << formatBytes(byteChange) << " / "
+        << (blockChange >= 0 ? "+" : "") << blockChange << " blocks)";
+    return out.str();
+}
+
 string formatMs(double ms) {
     ostringstream out;
     out << fixed << setprecision(4) << ms << " ms";
     return out.str();
 }
 
-size_t estimateLinkedListMemory(PassengerLinkedList& list) {
-    return static_cast<size_t>(list.getSize()) * sizeof(PassengerNode);
+// 950, 12.3k, 4.56M, 1.23G
+string formatCount(uint64_t count) {
+    ostringstream out;
+    out << fixed;
+    if (count >= 1000000000ULL) {
+        out << setprecision(2) << count / 1e9 << "G";
+    } else if (count >= 1000000ULL) {
+        out << setprecision(2) << count / 1e6 << "M";
+    } else if (count >= 1000ULL) {
+        out << setprecision(1) << count / 1e3 << "k";
+    } else {
+        out << count;
+    }
+    return out.str();
 }
 
-size_t estimateArrayReservedMemory() {
-    return sizeof(planes);
-}
+// Adds "Counters" and "Misses" lines under a timing line when the section
+// was counted; adds nothing when hardware counters are unavailable.
+// labelWidth matches the "Time         : " style labels of the box.
+void addHardwareCounterLines(UILines& lines, const HardwareCounterReading& reading, int labelWidth) {
+    if (!reading.available) {
+        return;
+    }
+    const uint64_t* values = reading.values;
+    string counts;
+    if (reading.present[HARDWARE_CYCLES]) {
+        counts += formatCount(values[HARDWARE_CYCLES]) + " cycles";
+    }
+    if (reading.present[HARDWARE_INSTRUCTIONS]) {
+        counts += (counts.empty() ? "" : " / ") + formatCount(values[HARDWARE_INSTRUCTIONS]) + " instr";
+    }
+    if (reading.present[HARDWARE_CYCLES] && reading.present[HARDWARE_INSTRUCTIONS] && values[HARDWARE_CYCLES] > 0) {
+        ostringstream ipc;
+        ipc << fixed << setprecision(2) << static_cast<double>(values[HARDWARE_INSTRUCTIONS]) / values[HARDWARE_CYCLES];
+        counts += " (IPC " + ipc.str() + ")";
+    }
+
+    string misses;
+    if (reading.present[HARDWARE_L1D_MISSES]) {
+        misses += "L1D " + formatCount(values[HARDWARE_L1D_MISSES]);
+    }
+    if (reading.present[HARDWARE_LLC_MISSES]) {
+        misses += (misses.empty() ? "" : " / ") + string("LLC ") + formatCount(values[HARDWARE_LLC_MISSES]);
+    }
+    if (reading.present[HARDWARE_BRANCH_MISSES]) {
+        misses += (misses.empty() ? "" : " / ") + string("branch ") + formatCount(values[HARDWARE_BRANCH_MISSES]);
+    }
 
-size_t estimateArrayActiveMemory() {
-    return static_cast<size_t>(activePlaneCount) * sizeof(Plane);
+    if (!counts.empty()) {
+        lines.add(string("Counters").append(labelWidth - 8, ' ') + ": " + counts);
+    }
+    if (!misses.empty()) {
+        lines.add(string("Misses").append(labelWidth - 6, ' ') + ": " + misses);
+    }
 }
 
 void printLine(char ch, int width) {
@@ -99,26 +182,30 @@ void printBox(const string& title, const UILines& lines, int width) {
 
 void resetArrayData() {
     activePlaneCount = 0;
-    for (int i = 0; i < MAX_PLANES; i++) {
-        planes[i] = Plane();
-    }
+    planes.clear();
+    clearPassengerIdIndex();
+    arrayPassengerNames.clear();
+    arrayFreeSeatTree.clear();
+    arraySeatPositionIndex.clear();
+    arrayFleetStatistics.clear();
 }
 
 bool loadArrayDataSilently(double& loadMs) {
+    MemoryTagScope memoryTag(MEMORY_TAG_ARRAY);
+    // The loader writes to its own stream, so nothing global is redirected and
+    // this can run on a worker thread while the Linked List loads
     ostringstream sink;
-    streambuf* original = cout.rdbuf();
-    cout.rdbuf(sink.rdbuf());
 
     auto start = chrono::high_resolution_clock::now();
-    bool result = loadPassengerDataFromCSV();
+    bool result = loadPassengerDataFromCSV(sink);
     auto end = chrono::high_resolution_clock::now();
 
-    cout.rdbuf(original);
     loadMs = chrono::duration<double, milli>(end - start).count();
     return result;
 }
 
 bool loadLinkedListData(PassengerLinkedList& list, double& loadMs) {
+    MemoryTagScope memoryTag(MEMORY_TAG_LINKED_LIST);
     auto start = chrono::high_resolution_clock::now();
     list = readPassengerCSV();
     auto end = chrono::high_resolution_clock::now();
@@ -127,7 +214,26 @@ bool loadLinkedListData(PassengerLinkedList& list, double& loadMs) {
     return list.getSize() > 0;
 }
 
-void printPerformanceDashboard(const LoadStats& stats, PassengerLinkedList& list) {
+// Runs after the Linked List load, which has just written the snapshot it reads
+bool loadUnrolledListData(UnrolledPassengerList& list, double& loadMs) {
+    MemoryTagScope memoryTag(MEMORY_TAG_UNROLLED_LIST);
+    auto start = chrono::high_resolution_clock::now();
+    list = readUnrolledPassengerData();
+    auto end = chrono::high_resolution_clock::now();
+
+    loadMs = chrono::duration<double, milli>(end - start).count();
+    return list.getSize() > 0;
+}
+
+// "4220 (F 300 / B 700 / E 3220)" - free seats overall and per class, read from the running counters
+string formatFreeSeats(const FleetStatistics& statistics) {
+    return to_string(statistics.getTotalAvailableSeats()) +
+           " (F " + to_string(statistics.getAvailableSeatsInClass(SEAT_CLASS_FIRST)) +
+           " / B " + to_string(statistics.getAvailableSeatsInClass(SEAT_CLASS_BUSINESS)) +
+           " / E " + to_string(statistics.getAvailableSeatsInClass(SEAT_CLASS_ECONOMY)) + ")";
+}
+
+void printPerformanceDashboard(const LoadStats& stats, PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     const int boxWidth = 68;
 
     cout << "\n";
@@ -138,21 +244,51 @@ void printPerformanceDashboard(const LoadStats& stats, PassengerLinkedList& list
     UILines linkedListLines;
     linkedListLines.add("Version        : Linked List");
     linkedListLines.add("Load Time      : " + formatMs(stats.linkedListLoadMs));
+    addHardwareCounterLines(linkedListLines, stats.linkedListCounters, 15);
     linkedListLines.add("Passengers     : " + to_string(list.getSize()));
     linkedListLines.add("Planes         : " + to_string(list.getTotalPlanes()));
-    linkedListLines.add("Est. Memory    : " + formatBytes(estimateLinkedListMemory(list)) + " (nodes only)");
+    linkedListLines.add("Free Seats     : " + formatFreeSeats(list.getStatistics()));
+    linkedListLines.add("Heap Memory    : " + formatMeasuredMemory(MEMORY_TAG_LINKED_LIST, list.getSize()));
+
+    UILines unrolledLines;
+    unrolledLines.add("Version        : Unrolled Linked List (" + to_string(UNROLLED_BLOCK_CAPACITY) + " per block)");
+    unrolledLines.add("Load Time      : " + formatMs(stats.unrolledListLoadMs));
+    addHardwareCounterLines(unrolledLines, stats.unrolledListCounters, 15);
+    unrolledLines.add("Passengers     : " + to_string(unrolledList.getSize()));
+    unrolledLines.add("Planes         : " + to_string(unrolledList.getTotalPlanes()));
+    unrolledLines.add("Free Seats     : " + formatFreeSeats(unrolledList.getStatistics()));
+    unrolledLines.add("List Blocks    : " + to_string(unrolledList.getBlockCount()));
+    unrolledLines.add("Heap Memory    : " + formatMeasuredMemory(MEMORY_TAG_UNROLLED_LIST, unrolledList.getSize()));
 
     UILines arrayLines;
-    arrayLines.add("Version        : Array (1D + 2D)");
+    arrayLines.add("Version        : Array (1D + Seat Bitmap)");
     arrayLines.add("Load Time      : " + formatMs(stats.arrayLoadMs));
+    addHardwareCounterLines(arrayLines, stats.arrayCounters, 15);
     arrayLines.add("Passengers     : " + to_string(getTotalPassengers()));
     arrayLines.add("Active Planes  : " + to_string(activePlaneCount));
-    arrayLines.add("Est. Reserved  : " + formatBytes(estimateArrayReservedMemory()));
-    arrayLines.add("Est. Active    : " + formatBytes(estimateArrayActiveMemory()));
+    arrayLines.add("Free Seats     : " + formatFreeSeats(arrayFleetStatistics));
+    arrayLines.add("Heap Memory    : " + formatMeasuredMemory(MEMORY_TAG_ARRAY, getTotalPassengers()));
+    arrayLines.add("Name Dict.     : " + formatBytes(arrayPassengerNames.bytesUsed()) +
+                   " (" + to_string(arrayPassengerNames.getFirstNameCount()) + " first / " +
+                   to_string(arrayPassengerNames.getLastNameCount()) + " last / " +
+                   to_string(arrayPassengerNames.getOutlierCount()) + " outliers)");
 
     printBox("Linked List Performance", linkedListLines, boxWidth);
     cout << "\n";
+    printBox("Unrolled List Performance", unrolledLines, boxWidth);
+    cout << "\n";
     printBox("Array Performance", arrayLines, boxWidth);
+    cout << "Load Wall Time : " << formatMs(stats.wallMs) << " (Array loads alongside the lists)\n";
+
+    size_t residentBytes = 0;
+    size_t peakResidentBytes = 0;
+    if (readProcessMemory(residentBytes, peakResidentBytes)) {
+        cout << "Process RSS    : " << formatBytes(residentBytes) << " (peak " << formatBytes(peakResidentBytes) << ")\n";
+    } else {
+        cout << "Process RSS    : N/A\n";
+    }
+    cout << "Other Heap     : " << formatMeasuredMemory(MEMORY_TAG_OTHER, 0) << " (menus, temporaries)\n";
+    cout << "HW Counters    : " << hardwareCountersStatus() << "\n";
     cout << "\n";
 }
 
@@ -232,6 +368,7 @@ struct ReservationResultView {
     int seatRowIndex;
     int seatColumnIndex;
     double elapsedMs;
+    HardwareCounterReading counters;
 };
 
 struct LookupResultView {
@@ -243,6 +380,15 @@ struct LookupResultView {
     int seatRowIndex;
     int seatColumnIndex;
     double elapsedMs;
+    HardwareCounterReading counters;
+};
+
+struct SeatPositionResultView {
+    int firstFreePlaneNumber; // -1 when the seat is taken on every plane
+    int occupiedPlaneCount;
+    vector<PassengerNode> occupants; // One per plane where the seat is taken, by plane number
+    double elapsedMs;
+    HardwareCounterReading counters;
 };
 
 void getClassRowRange(const string& passengerClass, int& startRowIndex, int& endRowIndex) {
@@ -325,19 +471,19 @@ PassengerManifest collectArrayManifest(int planeIndex) {
         return manifest;
     }
 
-    for (int i = 0; i < planes[planeIndex].activePassengerCount; i++) {
-        Passenger& arrayPassenger = planes[planeIndex].passengers[i];
+    for (int k = 0; k < planes[planeIndex].activePassengerCount; k++) {
+        Passenger& arrayPassenger = planes[planeIndex].passengers[planes[planeIndex].occupiedSlots[k]];
         if (!arrayPassenger.isActive) {
             continue;
         }
 
         PassengerNode& node = manifest.passengers[manifest.count++];
-        node.passengerId = arrayPassenger.passengerId;
-        node.passengerName = arrayPassenger.passengerName;
+        node.passengerId = passengerIdText(arrayPassenger);
+        node.passengerName = passengerNameText(arrayPassenger);
         node.seatRow = arrayPassenger.seatRow;
         node.seatColumn = arrayPassenger.seatColumn;
-        node.passengerClass = arrayPassenger.passengerClass;
-        node.planeNum = arrayPassenger.planeNumber + 1;
+        node.passengerClass = passengerClassText(arrayPassenger);
+        node.planeNum = planeIndex + 1;
     }
 
     return manifest;
@@ -353,7 +499,7 @@ SeatGrid collectArrayGrid(int planeIndex) {
 
     for (int row = 0; row < totalRows; row++) {
         for (int col = 0; col < totalColumns; col++) {
-            grid.grid[row][col] = planes[planeIndex].seatingGrid[row][col];
+            grid.grid[row][col] = getSeatMarker(planeIndex, row, col);
         }
     }
     return grid;
@@ -387,6 +533,41 @@ SeatGrid collectLinkedListGrid(PassengerLinkedList& list, int planeNumber) {
     return grid;
 }
 
+PassengerManifest collectUnrolledListManifest(UnrolledPassengerList& list, int planeNumber) {
+    const UnrolledPassengerRecord* seats[30][6];
+    list.getPassengersFromPlane(seats, planeNumber);
+
+    PassengerManifest manifest;
+    for (int row = 0; row < totalRows; row++) {
+        for (int col = 0; col < totalColumns; col++) {
+            const UnrolledPassengerRecord* record = seats[row][col];
+            if (record != nullptr) {
+                PassengerNode& node = manifest.passengers[manifest.count++];
+                node.passengerId = record->passengerId;
+                node.passengerName = record->passengerName;
+                node.seatRow = record->seatRow;
+                node.seatColumn = record->seatColumn;
+                node.passengerClass = record->passengerClass;
+                node.planeNum = record->planeNum;
+            }
+        }
+    }
+    return manifest;
+}
+
+SeatGrid collectUnrolledListGrid(UnrolledPassengerList& list, int planeNumber) {
+    const UnrolledPassengerRecord* seats[30][6];
+    list.getPassengersFromPlane(seats, planeNumber);
+
+    SeatGrid grid;
+    for (int row = 0; row < totalRows; row++) {
+        for (int col = 0; col < totalColumns; col++) {
+            grid.grid[row][col] = seats[row][col] == nullptr ? 'O' : 'X';
+        }
+    }
+    return grid;
+}
+
 ReservationResultView runLinkedListReservation(
     PassengerLinkedList& list,
     const string& passengerId,
@@ -397,7 +578,9 @@ ReservationResultView runLinkedListReservation(
     int seatColumn,
     int targetPlaneNumber = -1
 ) {
+    MemoryTagScope memoryTag(MEMORY_TAG_LINKED_LIST);
     ReservationResultView view{};
+    HardwareCounterSection counters;
     auto start = chrono::high_resolution_clock::now();
     ReservationInsertionResult result = insertPassengerReservation(
         list,
@@ -410,6 +593,46 @@ ReservationResultView runLinkedListReservation(
         targetPlaneNumber
     );
     auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+
+    view.success = result.isSuccessful;
+    view.message = result.errorMessage;
+    view.passengerId = passengerId;
+    view.passengerName = passengerName;
+    view.passengerClass = passengerClass;
+    view.planeNumber = result.planeNumber;
+    view.seatRowIndex = result.seatRowIndex;
+    view.seatColumnIndex = result.seatColumnIndex;
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+ReservationResultView runUnrolledListReservation(
+    UnrolledPassengerList& list,
+    const string& passengerId,
+    const string& passengerName,
+    const string& passengerClass,
+    bool hasPreferredSeat,
+    int seatRow,
+    int seatColumn,
+    int targetPlaneNumber = -1
+) {
+    MemoryTagScope memoryTag(MEMORY_TAG_UNROLLED_LIST);
+    ReservationResultView view{};
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    ReservationInsertionResult result = placePassengerReservation(
+        list,
+        passengerId,
+        passengerName,
+        passengerClass,
+        hasPreferredSeat,
+        seatRow,
+        seatColumn,
+        targetPlaneNumber
+    );
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
 
     view.success = result.isSuccessful;
     view.message = result.errorMessage;
@@ -432,6 +655,7 @@ ReservationResultView runArrayReservation(
     int seatColumn,
     int targetPlaneIndex = -1
 ) {
+    MemoryTagScope memoryTag(MEMORY_TAG_ARRAY);
     ReservationResultView view{};
     view.passengerId = passengerId;
     view.passengerName = passengerName;
@@ -469,41 +693,16 @@ ReservationResultView runArrayReservation(
             return view;
         }
     } else if (hasPreferredSeat) {
-        for (int i = 0; i < activePlaneCount; i++) {
-            if (!planes[i].isActive) {
-                continue;
-            }
-            if (isSeatAvailable(i, seatRow, seatColumn)) {
-                selectedPlane = i;
-                break;
-            }
-        }
+        selectedPlane = findPlaneWithSeatAvailable(seatRow, seatColumn);
 
         if (selectedPlane == -1) {
             OutputSilencer silencer;
             selectedPlane = createNewPlane();
         }
     } else {
-        for (int i = 0; i < activePlaneCount; i++) {
-            if (!planes[i].isActive) {
-                continue;
-            }
-            for (int row = startRow; row <= endRow; row++) {
-                for (int col = 0; col < totalColumns; col++) {
-                    if (isSeatAvailable(i, row, col)) {
-                        selectedPlane = i;
-                        selectedRow = row;
-                        selectedColumn = col;
-                        break;
-                    }
-                }
-                if (selectedPlane != -1) {
-                    break;
-                }
-            }
-            if (selectedPlane != -1) {
-                break;
-            }
+        int candidatePlane = findPlaneWithAvailableSeatInClass(passengerClass);
+        if (candidatePlane >= 0 && findAvailableSeatInClass(candidatePlane, passengerClass, selectedRow, selectedColumn)) {
+            selectedPlane = candidatePlane;
         }
 
         if (selectedPlane == -1) {
@@ -520,6 +719,7 @@ ReservationResultView runArrayReservation(
         return view;
     }
 
+    HardwareCounterSection counters;
     auto start = chrono::high_resolution_clock::now();
     bool result;
     {
@@ -534,6 +734,7 @@ ReservationResultView runArrayReservation(
         );
     }
     auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
 
     view.success = result;
     view.message = result ? "" : "Reservation could not be completed.";
@@ -545,10 +746,34 @@ ReservationResultView runArrayReservation(
 }
 
 ReservationResultView runLinkedListCancellation(PassengerLinkedList& list, const string& passengerId) {
+    MemoryTagScope memoryTag(MEMORY_TAG_LINKED_LIST);
     ReservationResultView view{};
+    HardwareCounterSection counters;
     auto start = chrono::high_resolution_clock::now();
     ReservationDeletionResult result = deletePassengerReservation(list, passengerId);
     auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+
+    view.success = result.isSuccessful;
+    view.message = result.errorMessage;
+    view.passengerId = result.passengerId;
+    view.passengerName = result.passengerName;
+    view.passengerClass = result.passengerClass;
+    view.planeNumber = result.planeNumber;
+    view.seatRowIndex = result.seatRowIndex;
+    view.seatColumnIndex = result.seatColumnIndex;
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+ReservationResultView runUnrolledListCancellation(UnrolledPassengerList& list, const string& passengerId) {
+    MemoryTagScope memoryTag(MEMORY_TAG_UNROLLED_LIST);
+    ReservationResultView view{};
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    ReservationDeletionResult result = removePassengerReservation(list, passengerId);
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
 
     view.success = result.isSuccessful;
     view.message = result.errorMessage;
@@ -563,6 +788,7 @@ ReservationResultView runLinkedListCancellation(PassengerLinkedList& list, const
 }
 
 ReservationResultView runArrayCancellation(const string& passengerId) {
+    MemoryTagScope memoryTag(MEMORY_TAG_ARRAY);
     ReservationResultView view{};
     view.passengerId = passengerId;
 
@@ -576,6 +802,7 @@ ReservationResultView runArrayCancellation(const string& passengerId) {
 
     Passenger passenger = planes[planeIndex].passengers[passengerIndex];
 
+    HardwareCounterSection counters;
     auto start = chrono::high_resolution_clock::now();
     bool result;
     {
@@ -583,12 +810,13 @@ ReservationResultView runArrayCancellation(const string& passengerId) {
         result = cancelReservation(passengerId);
     }
     auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
 
     view.success = result;
     view.message = result ? "" : "Cancellation failed.";
-    view.passengerName = passenger.passengerName;
-    view.passengerClass = passenger.passengerClass;
-    view.planeNumber = passenger.planeNumber + 1;
+    view.passengerName = passengerNameText(passenger);
+    view.passengerClass = passengerClassText(passenger);
+    view.planeNumber = planeIndex + 1;
     view.seatRowIndex = passenger.seatRow;
     view.seatColumnIndex = passenger.seatColumn;
     view.elapsedMs = chrono::duration<double, milli>(end - start).count();
@@ -597,9 +825,34 @@ ReservationResultView runArrayCancellation(const string& passengerId) {
 
 LookupResultView runLinkedListLookup(PassengerLinkedList& list, const string& passengerId) {
     LookupResultView view{};
+    HardwareCounterSection counters;
     auto start = chrono::high_resolution_clock::now();
     PassengerNode* passenger = list.searchPassenger(passengerId);
     auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+
+    view.found = passenger != nullptr;
+    view.passengerId = passengerId;
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+
+    if (passenger) {
+        view.passengerName = passenger->passengerName;
+        view.passengerClass = passenger->passengerClass;
+        view.planeNumber = passenger->planeNum;
+        view.seatRowIndex = passenger->seatRow;
+        view.seatColumnIndex = passenger->seatColumn;
+    }
+
+    return view;
+}
+
+LookupResultView runUnrolledListLookup(UnrolledPassengerList& list, const string& passengerId) {
+    LookupResultView view{};
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    UnrolledPassengerRecord* passenger = list.searchPassenger(passengerId);
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
 
     view.found = passenger != nullptr;
     view.passengerId = passengerId;
@@ -621,9 +874,11 @@ LookupResultView runArrayLookup(const string& passengerId) {
     int planeIndex = -1;
     int passengerIndex = -1;
 
+    HardwareCounterSection counters;
     auto start = chrono::high_resolution_clock::now();
     bool found = findPassengerByID(passengerId, planeIndex, passengerIndex);
     auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
 
     view.found = found;
     view.passengerId = passengerId;
@@ -631,9 +886,9 @@ LookupResultView runArrayLookup(const string& passengerId) {
 
     if (found) {
         Passenger& passenger = planes[planeIndex].passengers[passengerIndex];
-        view.passengerName = passenger.passengerName;
-        view.passengerClass = passenger.passengerClass;
-        view.planeNumber = passenger.planeNumber + 1;
+        view.passengerName = passengerNameText(passenger);
+        view.passengerClass = passengerClassText(passenger);
+        view.planeNumber = planeIndex + 1;
         view.seatRowIndex = passenger.seatRow;
         view.seatColumnIndex = passenger.seatColumn;
     }
@@ -641,6 +896,15 @@ LookupResultView runArrayLookup(const string& passengerId) {
     return view;
 }
 
+// addHardwareCounterLines for plain (unboxed) output
+void printHardwareCounterLines(const HardwareCounterReading& reading, int labelWidth) {
+    UILines lines;
+    addHardwareCounterLines(lines, reading, labelWidth);
+    for (int i = 0; i < lines.count; i++) {
+        cout << lines.lines[i] << "\n";
+    }
+}
+
 void printOperationBox(const string& title, const UILines& lines) {
     const int boxWidth = 68;
     printBox(title, lines, boxWidth);
@@ -671,16 +935,16 @@ string generateJointPassengerId(PassengerLinkedList& list) {
     return to_string(nextId);
 }
 
-void handleJointReservation(PassengerLinkedList& list) {
+void handleJointReservation(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     while (true) {
         clearScreen();
         cout << "\n========================================\n";
     cout << "     RESERVATION (ARRAY + LINKED LIST)\n";
         cout << "========================================\n\n";
 
-        size_t linkedListMemBefore = estimateLinkedListMemory(list);
-        size_t arrayReservedBefore = estimateArrayReservedMemory();
-        size_t arrayActiveBefore = estimateArrayActiveMemory();
+        MemoryUsage linkedListMemBefore = readMemoryUsage(MEMORY_TAG_LINKED_LIST);
+        MemoryUsage unrolledMemBefore = readMemoryUsage(MEMORY_TAG_UNROLLED_LIST);
+        MemoryUsage arrayMemBefore = readMemoryUsage(MEMORY_TAG_ARRAY);
 
         // 1. Get passenger name
         string passengerName;
@@ -835,16 +1099,20 @@ void handleJointReservation(PassengerLinkedList& list) {
             list, passengerId, passengerName, passengerClass, true, seatRow, seatColumn, selectedPlaneIndex + 1
         );
 
+        ReservationResultView unrolledResult = runUnrolledListReservation(
+            unrolledList, passengerId, passengerName, passengerClass, true, seatRow, seatColumn, selectedPlaneIndex + 1
+        );
+
         ReservationResultView arrayResult = runArrayReservation(
             passengerId, passengerName, passengerClass, true, seatRow, seatColumn, selectedPlaneIndex
         );
 
-        size_t linkedListMemAfter = estimateLinkedListMemory(list);
-        size_t arrayReservedAfter = estimateArrayReservedMemory();
-        size_t arrayActiveAfter = estimateArrayActiveMemory();
+        MemoryUsage linkedListMemAfter = readMemoryUsage(MEMORY_TAG_LINKED_LIST);
+        MemoryUsage unrolledMemAfter = readMemoryUsage(MEMORY_TAG_UNROLLED_LIST);
+        MemoryUsage arrayMemAfter = readMemoryUsage(MEMORY_TAG_ARRAY);
 
-        if (linkedListResult.success) savePassengerCSV(list);
-        if (arrayResult.success) savePassengerDataToCSV();
+        if (linkedListResult.success) commitPassengerJournal(list);
+        if (arrayResult.success) commitPassengerDataJournal();
 
         // 6. Stats and Report
         UILines llLines;
@@ -854,8 +1122,20 @@ void handleJointReservation(PassengerLinkedList& list) {
         llLines.add("Name         : " + passengerName);
         llLines.add("Plane        : " + to_string(linkedListResult.planeNumber));
         llLines.add("Seat         : " + to_string(linkedListResult.seatRowIndex + 1) + convertColumnIndexToChar(linkedListResult.seatColumnIndex));
-        llLines.add("Est. Memory  : " + formatBytes(linkedListMemAfter) + " (" + formatBytes(linkedListMemBefore) + " before)");
+        llLines.add("Heap Memory  : " + formatMemoryChange(linkedListMemBefore, linkedListMemAfter));
         llLines.add("Time         : " + formatMs(linkedListResult.elapsedMs));
+        addHardwareCounterLines(llLines, linkedListResult.counters, 13);
+
+        UILines urLines;
+        urLines.add("Status       : " + string(unrolledResult.success ? "SUCCESS" : "FAILED"));
+        if (!unrolledResult.success) urLines.add("Message      : " + unrolledResult.message);
+        urLines.add("Passenger ID : " + passengerId);
+        urLines.add("Name         : " + passengerName);
+        urLines.add("Plane        : " + to_string(unrolledResult.planeNumber));
+        urLines.add("Seat         : " + to_string(unrolledResult.seatRowIndex + 1) + convertColumnIndexToChar(unrolledResult.seatColumnIndex));
+        urLines.add("Heap Memory  : " + formatMemoryChange(unrolledMemBefore, unrolledMemAfter));
+        urLines.add("Time         : " + formatMs(unrolledResult.elapsedMs));
+        addHardwareCounterLines(urLines, unrolledResult.counters, 13);
 
         UILines arrLines;
         arrLines.add("Status       : " + string(arrayResult.success ? "SUCCESS" : "FAILED"));
@@ -864,13 +1144,15 @@ void handleJointReservation(PassengerLinkedList& list) {
         arrLines.add("Name         : " + passengerName);
         arrLines.add("Plane        : " + to_string(arrayResult.planeNumber));
         arrLines.add("Seat         : " + to_string(arrayResult.seatRowIndex + 1) + convertColumnIndexToChar(arrayResult.seatColumnIndex));
-        arrLines.add("Est. Reserved: " + formatBytes(arrayReservedAfter) + " (" + formatBytes(arrayReservedBefore) + " before)");
-        arrLines.add("Est. Active  : " + formatBytes(arrayActiveAfter) + " (" + formatBytes(arrayActiveBefore) + " before)");
+        arrLines.add("Heap Memory  : " + formatMemoryChange(arrayMemBefore, arrayMemAfter));
         arrLines.add("Time         : " + formatMs(arrayResult.elapsedMs));
+        addHardwareCounterLines(arrLines, arrayResult.counters, 13);
 
         cout << "\n";
         printOperationBox("Linked List Result", llLines);
         cout << "\n";
+        printOperationBox("Unrolled List Result", urLines);
+        cout << "\n";
         printOperationBox("Array Result", arrLines);
         cout << "\n";
         
@@ -879,32 +1161,33 @@ void handleJointReservation(PassengerLinkedList& list) {
     }
 }
 
-void handleJointCancellation(PassengerLinkedList& list) {
+void handleJointCancellation(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     clearScreen();
     cout << "\n========================================\n";
     cout << "     CANCELLATION (ARRAY + LINKED LIST)\n";
     cout << "========================================\n\n";
 
-    size_t linkedListMemBefore = estimateLinkedListMemory(list);
-    size_t arrayReservedBefore = estimateArrayReservedMemory();
-    size_t arrayActiveBefore = estimateArrayActiveMemory();
+    MemoryUsage linkedListMemBefore = readMemoryUsage(MEMORY_TAG_LINKED_LIST);
+    MemoryUsage unrolledMemBefore = readMemoryUsage(MEMORY_TAG_UNROLLED_LIST);
+    MemoryUsage arrayMemBefore = readMemoryUsage(MEMORY_TAG_ARRAY);
 
     string passengerId;
     cout << "Enter Passenger ID to cancel: ";
     getline(cin, passengerId);
 
     ReservationResultView linkedListResult = runLinkedListCancellation(list, passengerId);
+    ReservationResultView unrolledResult = runUnrolledListCancellation(unrolledList, passengerId);
     ReservationResultView arrayResult = runArrayCancellation(passengerId);
 
-    size_t linkedListMemAfter = estimateLinkedListMemory(list);
-    size_t arrayReservedAfter = estimateArrayReservedMemory();
-    size_t arrayActiveAfter = estimateArrayActiveMemory();
+    MemoryUsage linkedListMemAfter = readMemoryUsage(MEMORY_TAG_LINKED_LIST);
+    MemoryUsage unrolledMemAfter = readMemoryUsage(MEMORY_TAG_UNROLLED_LIST);
+    MemoryUsage arrayMemAfter = readMemoryUsage(MEMORY_TAG_ARRAY);
 
     if (linkedListResult.success) {
-        savePassengerCSV(list);
+        commitPassengerJournal(list);
     }
     if (arrayResult.success) {
-        savePassengerDataToCSV();
+        commitPassengerDataJournal();
     }
 
     UILines linkedListLines;
@@ -920,9 +1203,26 @@ void handleJointCancellation(PassengerLinkedList& list) {
         linkedListLines.add("Seat         : " + to_string(linkedListResult.seatRowIndex + 1) +
                                   convertColumnIndexToChar(linkedListResult.seatColumnIndex));
     }
-    linkedListLines.add("Est. Memory  : " + formatBytes(linkedListMemAfter) +
-                              " (" + formatBytes(linkedListMemBefore) + " before)");
+    linkedListLines.add("Heap Memory  : " + formatMemoryChange(linkedListMemBefore, linkedListMemAfter));
     linkedListLines.add("Time         : " + formatMs(linkedListResult.elapsedMs));
+    addHardwareCounterLines(linkedListLines, linkedListResult.counters, 13);
+
+    UILines unrolledLines;
+    unrolledLines.add("Status       : " + string(unrolledResult.success ? "SUCCESS" : "FAILED"));
+    if (!unrolledResult.success) {
+        unrolledLines.add("Message      : " + unrolledResult.message);
+    }
+    unrolledLines.add("Passenger ID : " + passengerId);
+    if (unrolledResult.success) {
+        unrolledLines.add("Name         : " + unrolledResult.passengerName);
+        unrolledLines.add("Class        : " + unrolledResult.passengerClass);
+        unrolledLines.add("Plane        : " + to_string(unrolledResult.planeNumber));
+        unrolledLines.add("Seat         : " + to_string(unrolledResult.seatRowIndex + 1) +
+                                convertColumnIndexToChar(unrolledResult.seatColumnIndex));
+    }
+    unrolledLines.add("Heap Memory  : " + formatMemoryChange(unrolledMemBefore, unrolledMemAfter));
+    unrolledLines.add("Time         : " + formatMs(unrolledResult.elapsedMs));
+    addHardwareCounterLines(unrolledLines, unrolledResult.counters, 13);
 
     UILines arrayLines;
     arrayLines.add("Status       : " + string(arrayResult.success ? "SUCCESS" : "FAILED"));
@@ -937,21 +1237,21 @@ void handleJointCancellation(PassengerLinkedList& list) {
         arrayLines.add("Seat         : " + to_string(arrayResult.seatRowIndex + 1) +
                               convertColumnIndexToChar(arrayResult.seatColumnIndex));
     }
-    arrayLines.add("Est. Reserved: " + formatBytes(arrayReservedAfter) +
-                         " (" + formatBytes(arrayReservedBefore) + " before)");
-    arrayLines.add("Est. Active  : " + formatBytes(arrayActiveAfter) +
-                         " (" + formatBytes(arrayActiveBefore) + " before)");
+    arrayLines.add("Heap Memory  : " + formatMemoryChange(arrayMemBefore, arrayMemAfter));
     arrayLines.add("Time         : " + formatMs(arrayResult.elapsedMs));
+    addHardwareCounterLines(arrayLines, arrayResult.counters, 13);
 
     cout << "\n";
     printOperationBox("Linked List Result", linkedListLines);
     cout << "\n";
+    printOperationBox("Unrolled List Result", unrolledLines);
+    cout << "\n";
     printOperationBox("Array Result", arrayLines);
     cout << "\n";
     pauseForUserInput();
 }
 
-void handleJointLookup(PassengerLinkedList& list) {
+void handleJointLookup(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     clearScreen();
     cout << "\n========================================\n";
     cout << "       SEAT LOOKUP (ARRAY + LINKED LIST)\n";
@@ -962,6 +1262,7 @@ void handleJointLookup(PassengerLinkedList& list) {
     getline(cin, passengerId);
 
     LookupResultView linkedListResult = runLinkedListLookup(list, passengerId);
+    LookupResultView unrolledResult = runUnrolledListLookup(unrolledList, passengerId);
     LookupResultView arrayResult = runArrayLookup(passengerId);
 
     UILines linkedListLines;
@@ -975,6 +1276,20 @@ void handleJointLookup(PassengerLinkedList& list) {
                                   PassengerconvertColumnIndexToChar(linkedListResult.seatColumnIndex));
     }
     linkedListLines.add("Time         : " + formatMs(linkedListResult.elapsedMs));
+    addHardwareCounterLines(linkedListLines, linkedListResult.counters, 13);
+
+    UILines unrolledLines;
+    unrolledLines.add("Status       : " + string(unrolledResult.found ? "FOUND" : "NOT FOUND"));
+    unrolledLines.add("Passenger ID : " + passengerId);
+    if (unrolledResult.found) {
+        unrolledLines.add("Name         : " + unrolledResult.passengerName);
+        unrolledLines.add("Class        : " + unrolledResult.passengerClass);
+        unrolledLines.add("Plane        : " + to_string(unrolledResult.planeNumber));
+        unrolledLines.add("Seat         : " + to_string(unrolledResult.seatRowIndex + 1) +
+                                PassengerconvertColumnIndexToChar(unrolledResult.seatColumnIndex));
+    }
+    unrolledLines.add("Time         : " + formatMs(unrolledResult.elapsedMs));
+    addHardwareCounterLines(unrolledLines, unrolledResult.counters, 13);
 
     UILines arrayLines;
     arrayLines.add("Status       : " + string(arrayResult.found ? "FOUND" : "NOT FOUND"));
@@ -987,15 +1302,287 @@ void handleJointLookup(PassengerLinkedList& list) {
                                convertColumnIndexToChar(arrayResult.seatColumnIndex));
     }
     arrayLines.add("Time         : " + formatMs(arrayResult.elapsedMs));
+    addHardwareCounterLines(arrayLines, arrayResult.counters, 13);
 
     cout << "\n";
     printOperationBox("Linked List Result", linkedListLines);
     cout << "\n";
+    printOperationBox("Unrolled List Result", unrolledLines);
+    cout << "\n";
     printOperationBox("Array Result", arrayLines);
     cout << "\n";
     pauseForUserInput();
 }
 
+// --- Seat Position Query (which planes have a given seat free / taken) ---
+
+SeatPositionResultView runArraySeatPositionQuery(int seatRowIndex, int seatColumnIndex) {
+    SeatPositionResultView view{};
+    int slot = seatSlotIndex(seatRowIndex, seatColumnIndex);
+
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    int firstFreePlane = findPlaneWithSeatAvailable(seatRowIndex, seatColumnIndex);
+    vector<int> occupiedPlanes = arraySeatPositionIndex.collectPlanesWithSeatOccupied(slot);
+    for (int planeIndex : occupiedPlanes) {
+        // The seat slot addresses the occupant directly
+        Passenger& arrayPassenger = planes[planeIndex].passengers[slot];
+        PassengerNode node;
+        node.passengerId = passengerIdText(arrayPassenger);
+        node.passengerName = passengerNameText(arrayPassenger);
+        node.seatRow = arrayPassenger.seatRow;
+        node.seatColumn = arrayPassenger.seatColumn;
+        node.passengerClass = passengerClassText(arrayPassenger);
+        node.planeNum = planeIndex + 1;
+        view.occupants.push_back(node);
+    }
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+
+    view.firstFreePlaneNumber = firstFreePlane >= 0 ? firstFreePlane + 1 : -1;
+    view.occupiedPlaneCount = static_cast<int>(occupiedPlanes.size());
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+SeatPositionResultView runLinkedListSeatPositionQuery(PassengerLinkedList& list, int seatRowIndex, int seatColumnIndex) {
+    SeatPositionResultView view{};
+
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    int firstFreePlane = list.findFirstPlaneWithSeatFree(seatRowIndex, seatColumnIndex);
+    vector<int> occupiedPlanes = list.getPlanesWithSeatOccupied(seatRowIndex, seatColumnIndex);
+
+    // Each occupant is picked off its own plane's chain, lowest plane first
+    for (int planeNumber : occupiedPlanes) {
+        PassengerNode* occupant = list.getPassengerInSeat(planeNumber, seatRowIndex, seatColumnIndex);
+        if (occupant != nullptr) {
+            view.occupants.push_back(*occupant);
+            view.occupants.back().next = nullptr;
+            view.occupants.back().nextInPlane = nullptr;
+            view.occupants.back().prev = nullptr;
+            view.occupants.back().prevInPlane = nullptr;
+        }
+    }
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+
+    view.firstFreePlaneNumber = firstFreePlane <= list.getTotalPlanes() ? firstFreePlane : -1;
+    view.occupiedPlaneCount = static_cast<int>(occupiedPlanes.size());
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+SeatPositionResultView runUnrolledListSeatPositionQuery(UnrolledPassengerList& list, int seatRowIndex, int seatColumnIndex) {
+    SeatPositionResultView view{};
+
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    int firstFreePlane = list.findFirstPlaneWithSeatFree(seatRowIndex, seatColumnIndex);
+    vector<int> occupiedPlanes = list.getPlanesWithSeatOccupied(seatRowIndex, seatColumnIndex);
+
+    // Records are not addressable by seat, so pick the occupants up in one pass over the blocks
+    if (!occupiedPlanes.empty()) {
+        list.forEachPassenger([&](const UnrolledPassengerRecord& record) {
+            if (record.seatRow == seatRowIndex && record.seatColumn == seatColumnIndex) {
+                view.occupants.push_back(PassengerNode(record.passengerId, record.passengerName, record.seatRow,
+                                                       record.seatColumn, record.planeNum, record.passengerClass));
+            }
+        });
+        sort(view.occupants.begin(), view.occupants.end(), [](const PassengerNode& a, const PassengerNode& b) {
+            return a.planeNum < b.planeNum;
+        });
+    }
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+
+    view.firstFreePlaneNumber = firstFreePlane <= list.getTotalPlanes() ? firstFreePlane : -1;
+    view.occupiedPlaneCount = static_cast<int>(occupiedPlanes.size());
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+void handleJointSeatPositionLookup(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
+    clearScreen();
+    cout << "\n========================================\n";
+    cout << "  SEAT POSITION LOOKUP (ALL PLANES)\n";
+    cout << "========================================\n\n";
+
+    int seatRow = 0;
+    int seatColumn = 0;
+    readSeatPreference(seatRow, seatColumn);
+    string seatLabel = to_string(seatRow + 1) + convertColumnIndexToChar(seatColumn);
+
+    SeatPositionResultView linkedListResult = runLinkedListSeatPositionQuery(list, seatRow, seatColumn);
+    SeatPositionResultView unrolledResult = runUnrolledListSeatPositionQuery(unrolledList, seatRow, seatColumn);
+    SeatPositionResultView arrayResult = runArraySeatPositionQuery(seatRow, seatColumn);
+
+    UILines linkedListLines;
+    linkedListLines.add("Seat         : " + seatLabel);
+    linkedListLines.add("First Free On: " + (linkedListResult.firstFreePlaneNumber > 0
+                                                 ? "Plane #" + to_string(linkedListResult.firstFreePlaneNumber)
+                                                 : string("None (taken on every plane)")));
+    linkedListLines.add("Occupied On  : " + to_string(linkedListResult.occupiedPlaneCount) + " plane(s)");
+    linkedListLines.add("Time         : " + formatMs(linkedListResult.elapsedMs));
+    addHardwareCounterLines(linkedListLines, linkedListResult.counters, 13);
+
+    UILines unrolledLines;
+    unrolledLines.add("Seat         : " + seatLabel);
+    unrolledLines.add("First Free On: " + (unrolledResult.firstFreePlaneNumber > 0
+                                               ? "Plane #" + to_string(unrolledResult.firstFreePlaneNumber)
+                                               : string("None (taken on every plane)")));
+    unrolledLines.add("Occupied On  : " + to_string(unrolledResult.occupiedPlaneCount) + " plane(s)");
+    unrolledLines.add("Time         : " + formatMs(unrolledResult.elapsedMs));
+    addHardwareCounterLines(unrolledLines, unrolledResult.counters, 13);
+
+    UILines arrayLines;
+    arrayLines.add("Seat         : " + seatLabel);
+    arrayLines.add("First Free On: " + (arrayResult.firstFreePlaneNumber > 0
+                                            ? "Plane #" + to_string(arrayResult.firstFreePlaneNumber)
+                                            : string("None (taken on every plane)")));
+    arrayLines.add("Occupied On  : " + to_string(arrayResult.occupiedPlaneCount) + " plane(s)");
+    arrayLines.add("Time         : " + formatMs(arrayResult.elapsedMs));
+    addHardwareCounterLines(arrayLines, arrayResult.counters, 13);
+
+    // Occupant list (using Array system)
+    cout << "\nOCCUPANTS OF SEAT " << seatLabel << "\n";
+    cout << left << setw(8) << "Plane" << setw(10) << "ID" << setw(25) << "Name" << setw(12) << "Class" << "\n";
+    cout << string(55, '-') << "\n";
+    for (const PassengerNode& passenger : arrayResult.occupants) {
+        cout << left << setw(8) << ("#" + to_string(passenger.planeNum))
+             << setw(10) << passenger.passengerId
+             << setw(25) << passenger.passengerName.substr(0, 23)
+             << setw(12) << passenger.passengerClass << "\n";
+    }
+
+    cout << "\n";
+    printOperationBox("Linked List Result", linkedListLines);
+    cout << "\n";
+    printOperationBox("Unrolled List Result", unrolledLines);
+    cout << "\n";
+    printOperationBox("Array Result", arrayLines);
+    cout << "\n";
+    pauseForUserInput();
+}
+
+// --- Passenger ID Range Report (ordered by ID, for audits) ---
+
+struct IdRangeResultView {
+    vector<PassengerNode> passengers; // In ID order
+    double elapsedMs;
+    HardwareCounterReading counters;
+};
+
+IdRangeResultView runLinkedListIdRangeQuery(PassengerLinkedList& list, uint64_t firstId, uint64_t lastId) {
+    IdRangeResultView view{};
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    list.forEachPassengerInIdRange(firstId, lastId, [&](const PassengerNode* passenger) {
+        view.passengers.push_back(*passenger);
+        view.passengers.back().next = nullptr;
+        view.passengers.back().nextInPlane = nullptr;
+        view.passengers.back().prev = nullptr;
+        view.passengers.back().prevInPlane = nullptr;
+    });
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+// The same range without the skip list: one pass over every node, then a sort
+IdRangeResultView runLinkedListIdRangeScan(PassengerLinkedList& list, uint64_t firstId, uint64_t lastId) {
+    IdRangeResultView view{};
+    HardwareCounterSection counters;
+    auto start = chrono::high_resolution_clock::now();
+    vector<pair<uint64_t, const PassengerNode*>> matches;
+    for (PassengerNode* current = list.getHead(); current != nullptr; current = current->next) {
+        uint64_t key = 0;
+        if (parsePassengerIdKey(current->passengerId, key) && key >= firstId && key <= lastId) {
+            matches.emplace_back(key, current);
+        }
+    }
+    stable_sort(matches.begin(), matches.end(), [](const pair<uint64_t, const PassengerNode*>& a, const pair<uint64_t, const PassengerNode*>& b) {
+        return a.first < b.first;
+    });
+    for (const pair<uint64_t, const PassengerNode*>& match : matches) {
+        view.passengers.push_back(*match.second);
+        view.passengers.back().next = nullptr;
+        view.passengers.back().nextInPlane = nullptr;
+        view.passengers.back().prev = nullptr;
+        view.passengers.back().prevInPlane = nullptr;
+    }
+    auto end = chrono::high_resolution_clock::now();
+    view.counters = counters.stop();
+    view.elapsedMs = chrono::duration<double, milli>(end - start).count();
+    return view;
+}
+
+uint64_t readPassengerIdKey(const string& prompt) {
+    while (true) {
+        cout << prompt;
+        string input;
+        getline(cin, input);
+        uint64_t key = 0;
+        if (parsePassengerIdKey(trimWhitespace(input), key)) {
+            return key;
+        }
+        cout << "[ERROR] Enter a numeric Passenger ID.\n";
+    }
+}
+
+void handlePassengerIdRangeReport(PassengerLinkedList& list) {
+    clearScreen();
+    cout << "\n========================================\n";
+    cout << "   PASSENGER ID RANGE (LINKED LIST)\n";
+    cout << "========================================\n\n";
+
+    uint64_t firstId = readPassengerIdKey("Enter First Passenger ID: ");
+    uint64_t lastId = readPassengerIdKey("Enter Last Passenger ID : ");
+    if (firstId > lastId) {
+        swap(firstId, lastId);
+    }
+
+    IdRangeResultView indexResult = runLinkedListIdRangeQuery(list, firstId, lastId);
+    IdRangeResultView scanResult = runLinkedListIdRangeScan(list, firstId, lastId);
+
+    cout << "\n" << left << setw(10) << "ID" << setw(25) << "Name" << setw(8) << "Plane" << setw(8) << "Seat"
+         << setw(12) << "Class" << "\n";
+    cout << string(63, '-') << "\n";
+    for (const PassengerNode& passenger : indexResult.passengers) {
+        cout << left << setw(10) << passenger.passengerId
+             << setw(25) << passenger.passengerName.substr(0, 23)
+             << setw(8) << ("#" + to_string(passenger.planeNum))
+             << setw(8) << (to_string(passenger.seatRow + 1) + PassengerconvertColumnIndexToChar(passenger.seatColumn))
+             << setw(12) << passenger.passengerClass << "\n";
+    }
+
+    UILines lines;
+    lines.add("ID Range       : " + to_string(firstId) + " - " + to_string(lastId));
+    lines.add("Passengers     : " + to_string(indexResult.passengers.size()));
+    lines.add("Skip List Time : " + formatMs(indexResult.elapsedMs) +
+              (list.isIdIndexEnabled() ? "" : " (index disabled)"));
+    addHardwareCounterLines(lines, indexResult.counters, 14);
+    lines.add("Full Scan Time : " + formatMs(scanResult.elapsedMs) + " (walk + sort)");
+    addHardwareCounterLines(lines, scanResult.counters, 14);
+
+    cout << "\n";
+    printOperationBox("Linked List Result", lines);
+    cout << "\n";
+
+    if (!indexResult.passengers.empty() && readYesNo("Export this range to CSV? (Y/N): ")) {
+        string auditPath = replaceFileExtension(csvFilePath, "") + "_Audit_" + to_string(firstId) + "_" +
+                           to_string(lastId) + ".csv";
+        int exported = exportPassengerIdRange(list, firstId, lastId, auditPath);
+        if (exported < 0) {
+            cout << "[ERROR] Could not write " << auditPath << "\n";
+        } else {
+            cout << "[INFO] " << exported << " passenger(s) written to " << auditPath << "\n";
+        }
+    }
+    pauseForUserInput();
+}
+
 // --- Global Passenger List Performance Runners ---
 
 double runLinkedListGlobalList(PassengerLinkedList& list, const string& filterClass) {
@@ -1017,6 +1604,22 @@ double runLinkedListGlobalList(PassengerLinkedList& list, const string& filterCl
     return chrono::duration<double, milli>(end - start).count();
 }
 
+double runUnrolledListGlobalList(UnrolledPassengerList& list, const string& filterClass) {
+    auto start = chrono::high_resolution_clock::now();
+
+    // Performance timing: traverse the blocks silently
+    string filterUpper = toUpperCase(filterClass);
+    int count = 0;
+    list.forEachPassenger([&](const UnrolledPassengerRecord& record) {
+        if (filterClass.empty() || toUpperCase(record.passengerClass) == filterUpper) {
+            count++;
+        }
+    });
+
+    auto end = chrono::high_resolution_clock::now();
+    return chrono::duration<double, milli>(end - start).count();
+}
+
 double runArrayGlobalList(const string& filterClass, bool silent) {
     auto start = chrono::high_resolution_clock::now();
     
@@ -1028,9 +1631,10 @@ double runArrayGlobalList(const string& filterClass, bool silent) {
         int count = 0;
         for (int p = 0; p < activePlaneCount; p++) {
             if (!planes[p].isActive) continue;
-            for (int i = 0; i < planes[p].activePassengerCount; i++) {
+            for (int k = 0; k < planes[p].activePassengerCount; k++) {
+                int i = planes[p].occupiedSlots[k];
                 if (planes[p].passengers[i].isActive) {
-                    if (filterClass.empty() || toUpperCase(planes[p].passengers[i].passengerClass) == filterUpper) {
+                    if (filterClass.empty() || toUpperCase(passengerClassText(planes[p].passengers[i])) == filterUpper) {
                         count++;
                     }
                 }
@@ -1042,7 +1646,7 @@ double runArrayGlobalList(const string& filterClass, bool silent) {
     return chrono::duration<double, milli>(end - start).count();
 }
 
-void handleJointAllPassengers(PassengerLinkedList& list) {
+void handleJointAllPassengers(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     clearScreen();
     cout << "\n========================================\n";
     cout << "      GLOBAL PASSENGER LIST\n";
@@ -1076,16 +1680,27 @@ void handleJointAllPassengers(PassengerLinkedList& list) {
         }
     }
 
-    // 1. Get pure performance timing for both systems (silent)
+    // 1. Get pure performance timing for every system (silent)
+    HardwareCounterSection llSection;
     double llTime = runLinkedListGlobalList(list, filterClass);
+    HardwareCounterReading llCounters = llSection.stop();
+    HardwareCounterSection urSection;
+    double urTime = runUnrolledListGlobalList(unrolledList, filterClass);
+    HardwareCounterReading urCounters = urSection.stop();
+    HardwareCounterSection arrSection;
     double arrTime = runArrayGlobalList(filterClass, true);
+    HardwareCounterReading arrCounters = arrSection.stop();
 
     // 2. Perform the actual display once (using Array system)
     displayGlobalPassengerList(filterClass);
 
     UILines stats;
-    stats.add("Linked List Search Time : " + formatMs(llTime));
-    stats.add("Array Search Time       : " + formatMs(arrTime));
+    stats.add("Linked List Search Time   : " + formatMs(llTime));
+    addHardwareCounterLines(stats, llCounters, 26);
+    stats.add("Unrolled List Search Time : " + formatMs(urTime));
+    addHardwareCounterLines(stats, urCounters, 26);
+    stats.add("Array Search Time         : " + formatMs(arrTime));
+    addHardwareCounterLines(stats, arrCounters, 26);
 
     cout << "\n";
     printOperationBox("Search Performance (Global Manifest)", stats);
@@ -1093,7 +1708,7 @@ void handleJointAllPassengers(PassengerLinkedList& list) {
     pauseForUserInput();
 }
 
-void handleJointManifest(PassengerLinkedList& list) {
+void handleJointManifest(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     clearScreen();
     cout << "\n========================================\n";
     cout << "   MANIFEST & SEAT REPORT (JOINT VIEW)\n";
@@ -1101,7 +1716,7 @@ void handleJointManifest(PassengerLinkedList& list) {
 
     int linkedListPlanes = list.getTotalPlanes();
     int arrayPlanes = activePlaneCount;
-    int maxPlane = max(linkedListPlanes, arrayPlanes);
+    int maxPlane = max({linkedListPlanes, unrolledList.getTotalPlanes(), arrayPlanes});
 
     if (maxPlane < 1) {
         cout << "[INFO] No planes loaded.\n";
@@ -1126,56 +1741,89 @@ void handleJointManifest(PassengerLinkedList& list) {
     int arrayPlaneIndex = planeNumber - 1;
     bool arrayValid = arrayPlaneIndex >= 0 && arrayPlaneIndex < activePlaneCount && planes[arrayPlaneIndex].isActive;
     bool linkedListValid = planeNumber >= 1 && planeNumber <= linkedListPlanes;
+    bool unrolledValid = planeNumber >= 1 && planeNumber <= unrolledList.getTotalPlanes();
 
-    if (!linkedListValid && !arrayValid) {
-        cout << "\n[INFO] Plane " << planeNumber << " is not available in either version.\n";
+    if (!linkedListValid && !unrolledValid && !arrayValid) {
+        cout << "\n[INFO] Plane " << planeNumber << " is not available in any version.\n";
         cout << "\n";
         pauseForUserInput();
         return;
     }
 
     double linkedListMs = -1.0;
+    double unrolledMs = -1.0;
     double arrayMs = -1.0;
+    HardwareCounterReading linkedListCounters;
+    HardwareCounterReading unrolledCounters;
+    HardwareCounterReading arrayCounters;
 
     SeatGrid linkedListGrid;
     PassengerManifest linkedListManifest;
+    SeatGrid unrolledGrid;
+    PassengerManifest unrolledManifest;
     SeatGrid arrayGrid;
     PassengerManifest arrayManifest;
 
     if (linkedListValid) {
+        HardwareCounterSection counters;
         auto start = chrono::high_resolution_clock::now();
         linkedListGrid = collectLinkedListGrid(list, planeNumber);
         linkedListManifest = collectLinkedListManifest(list, planeNumber);
         auto end = chrono::high_resolution_clock::now();
+        linkedListCounters = counters.stop();
         linkedListMs = chrono::duration<double, milli>(end - start).count();
     }
 
+    if (unrolledValid) {
+        HardwareCounterSection counters;
+        auto start = chrono::high_resolution_clock::now();
+        unrolledGrid = collectUnrolledListGrid(unrolledList, planeNumber);
+        unrolledManifest = collectUnrolledListManifest(unrolledList, planeNumber);
+        auto end = chrono::high_resolution_clock::now();
+        unrolledCounters = counters.stop();
+        unrolledMs = chrono::duration<double, milli>(end - start).count();
+    }
+
     if (arrayValid) {
+        HardwareCounterSection counters;
         auto start = chrono::high_resolution_clock::now();
         arrayGrid = collectArrayGrid(arrayPlaneIndex);
         arrayManifest = collectArrayManifest(arrayPlaneIndex);
         auto end = chrono::high_resolution_clock::now();
+        arrayCounters = counters.stop();
         arrayMs = chrono::duration<double, milli>(end - start).count();
     }
 
     if (linkedListValid) {
         renderSeatGrid(linkedListGrid, "\nSEAT GRID (Plane " + to_string(planeNumber) + ")");
         renderManifest(linkedListManifest, "\nPASSENGER MANIFEST");
+    } else if (unrolledValid) {
+        renderSeatGrid(unrolledGrid, "\nSEAT GRID (Plane " + to_string(planeNumber) + ")");
+        renderManifest(unrolledManifest, "\nPASSENGER MANIFEST");
     } else {
         renderSeatGrid(arrayGrid, "\nSEAT GRID (Plane " + to_string(planeNumber) + ")");
         renderManifest(arrayManifest, "\nPASSENGER MANIFEST");
     }
 
     cout << "\nPerformance Metrics\n";
-    cout << "Linked List Time: ";
+    cout << "Linked List Time  : ";
     if (linkedListMs >= 0.0) {
         cout << formatMs(linkedListMs) << "\n";
+        printHardwareCounterLines(linkedListCounters, 18);
     } else {
         cout << "N/A\n";
     }
-    cout << "Array Time     : ";
+    cout << "Unrolled List Time: ";
+    if (unrolledMs >= 0.0) {
+        cout << formatMs(unrolledMs) << "\n";
+        printHardwareCounterLines(unrolledCounters, 18);
+    } else {
+        cout << "N/A\n";
+    }
+    cout << "Array Time        : ";
     if (arrayMs >= 0.0) {
         cout << formatMs(arrayMs) << "\n";
+        printHardwareCounterLines(arrayCounters, 18);
     } else {
         cout << "N/A\n";
     }
@@ -1183,11 +1831,33 @@ void handleJointManifest(PassengerLinkedList& list) {
     pauseForUserInput();
 }
 
-LoadStats loadAllData(PassengerLinkedList& list) {
+LoadStats loadAllData(PassengerLinkedList& list, UnrolledPassengerList& unrolledList) {
     LoadStats stats{};
     resetArrayData();
-    stats.arrayLoaded = loadArrayDataSilently(stats.arrayLoadMs);
-    stats.linkedListLoaded = loadLinkedListData(list, stats.linkedListLoadMs);
+
+    // The Array shares no state with the lists while loading, so it loads on a
+    // worker thread while this thread loads the Linked List and then the
+    // Unrolled List (which reads the files the Linked List load just wrote)
+    auto start = chrono::high_resolution_clock::now();
+    thread arrayLoader([&stats]() {
+        HardwareCounterSection counters; // Counts the worker thread
+        stats.arrayLoaded = loadArrayDataSilently(stats.arrayLoadMs);
+        stats.arrayCounters = counters.stop();
+    });
+    {
+        HardwareCounterSection counters;
+        stats.linkedListLoaded = loadLinkedListData(list, stats.linkedListLoadMs);
+        stats.linkedListCounters = counters.stop();
+    }
+    {
+        HardwareCounterSection counters;
+        stats.unrolledListLoaded = loadUnrolledListData(unrolledList, stats.unrolledListLoadMs);
+        stats.unrolledListCounters = counters.stop();
+    }
+    arrayLoader.join();
+    auto end = chrono::high_resolution_clock::now();
+
+    stats.wallMs = chrono::duration<double, milli>(end - start).count();
     return stats;
 }
 
@@ -1200,19 +1870,26 @@ void printMainMenu() {
     cout << "3. Seat Lookup (Search)\n";
     cout << "4. Manifest & Seat Report\n";
     cout << "5. Global Passenger List (All Planes)\n";
-    cout << "6. Refresh Performance Stats\n";
-    cout << "7. Exit\n";
+    cout << "6. Seat Position Lookup (All Planes)\n";
+    cout << "7. Passenger ID Range (Audit)\n";
+    cout << "8. Refresh Performance Stats\n";
+    cout << "9. Exit\n";
     cout << "----------------------------------------\n";
     cout << "Enter choice: ";
 }
 
+// Benchmark/BenchmarkMain.cpp includes this file for the operations above
+// and supplies its own entry point instead of the interactive menu
+#ifndef FLIGHT_RESERVATION_HEADLESS
 int main() {
-    LoadStats stats = loadAllData(passengerLinkedList);
+    // Interactive runs report counters next to every timing; the benchmark leaves them off
+    enableHardwareCounters();
+    LoadStats stats = loadAllData(passengerLinkedList, unrolledPassengerList);
     bool running = true;
 
     while (running) {
         clearScreen();
-        printPerformanceDashboard(stats, passengerLinkedList);
+        printPerformanceDashboard(stats, passengerLinkedList, unrolledPassengerList);
         printMainMenu();
 
         int choice;
@@ -1224,24 +1901,30 @@ int main() {
 
         switch (choice) {
             case 1:
-                handleJointReservation(passengerLinkedList);
+                handleJointReservation(passengerLinkedList, unrolledPassengerList);
                 break;
             case 2:
-                handleJointCancellation(passengerLinkedList);
+                handleJointCancellation(passengerLinkedList, unrolledPassengerList);
                 break;
             case 3:
-                handleJointLookup(passengerLinkedList);
+                handleJointLookup(passengerLinkedList, unrolledPassengerList);
                 break;
             case 4:
-                handleJointManifest(passengerLinkedList);
+                handleJointManifest(passengerLinkedList, unrolledPassengerList);
                 break;
             case 5:
-                handleJointAllPassengers(passengerLinkedList);
+                handleJointAllPassengers(passengerLinkedList, unrolledPassengerList);
                 break;
             case 6:
-                stats = loadAllData(passengerLinkedList);
+                handleJointSeatPositionLookup(passengerLinkedList, unrolledPassengerList);
                 break;
             case 7:
+                handlePassengerIdRangeReport(passengerLinkedList);
+                break;
+            case 8:
+                stats = loadAllData(passengerLinkedList, unrolledPassengerList);
+                break;
+            case 9:
                 running = false;
                 break;
             default:
@@ -1251,3 +1934,4 @@ int main() {
 
     return 0;
 }
+#endif
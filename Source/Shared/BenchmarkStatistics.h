@@ -0,0 +1,202 @@
+/*
+===============================================================================
+SHARED BENCHMARK STATISTICS - TIMING SAMPLES TO ROBUST SUMMARIES
+===============================================================================
+Used by: Benchmark harness (Benchmark/BenchmarkMain.cpp, including its scaling mode)
+
+One timing sample is the average time per operation over a batch of calls, so
+even sub-microsecond operations are measured well above the clock's
+resolution. A run of samples is summarised after dropping outliers with
+Tukey's fences (outside [Q1 - 1.5 IQR, Q3 + 1.5 IQR]), which removes
+one-off stalls such as page faults or the scheduler preempting the thread:
+
+  summarizeSamples(samples) : min, median, p99, mean and ops/s of the kept
+                              samples, plus how many were dropped
+
+Percentiles use the nearest-rank method on the sorted samples.
+
+Scaling curves are fitted in log-log space: if time ~ c * n^k then
+log(time) is a straight line in log(n) with slope k, so the least-squares
+slope estimates the exponent and classifyGrowth() maps it to O(1), O(n) or
+O(n^2) (O(log n) lands in O(1), O(n log n) in O(n)). Cache effects push a
+fitted exponent above the true one as the data outgrows each cache level -
+a linear walk measures 1.5 or more - so an exponent has to clear the
+midpoint between two classes by GROWTH_CLASS_MARGIN to take the higher one.
+===============================================================================
+*/
+
+#ifndef SHARED_BENCHMARK_STATISTICS_H
+#define SHARED_BENCHMARK_STATISTICS_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+const double BENCHMARK_OUTLIER_FENCE = 1.5; // IQR multiple beyond the quartiles
+
+struct SampleSummary {
+    int samples;          // Samples kept after outlier removal
+    int outliersRemoved;
+    double minNs;
+    double medianNs;
+    double p99Ns;
+    double meanNs;
+    double opsPerSecond;  // From the mean of the kept samples
+
+    SampleSummary()
+        : samples(0), outliersRemoved(0), minNs(0), medianNs(0), p99Ns(0), meanNs(0), opsPerSecond(0) {}
+};
+
+// Nearest-rank percentile (0-100) of samples already sorted ascending
+inline double sortedPercentile(const vector<double>& sorted, double percentile) {
+    if (sorted.empty()) {
+        return 0;
+    }
+    size_t rank = static_cast<size_t>(ceil(percentile / 100.0 * static_cast<double>(sorted.size())));
+    if (rank == 0) {
+        rank = 1;
+    }
+    return sorted[min(rank, sorted.size()) - 1];
+}
+
+inline SampleSummary summarizeSamples(vector<double> samplesNs) {
+    SampleSummary summary;
+    if (samplesNs.empty()) {
+        return summary;
+    }
+    sort(samplesNs.begin(), samplesNs.end());
+
+    double firstQuartile = sortedPercentile(samplesNs, 25);
+    double thirdQuartile = sortedPercentile(samplesNs, 75);
+    double fence = BENCHMARK_OUTLIER_FENCE * (thirdQuartile - firstQuartile);
+    vector<double> kept;
+    kept.reserve(samplesNs.size());
+    for (double sample : samplesNs) {
+        if (sample >= firstQuartile - fence && sample <= thirdQuartile + fence) {
+            kept.push_back(sample);
+        }
+    }
+
+    summary.samples = static_cast<int>(kept.size());
+    summary.outliersRemoved = static_cast<int>(samplesNs.size() - kept.size());
+    summary.minNs = kept.front();
+    summary.medianNs = sortedPercentile(kept, 50);
+    summary.p99Ns = sortedPercentile(kept, 99);
+    double total = 0;
+    for (double sample : kept) {
+        total += sample;
+    }
+    summary.meanNs = total / static_cast<double>(kept.size());
+    summary.opsPerSecond = summary.meanNs > 0 ? 1e9 / summary.meanNs : 0;
+    return summary;
+}
+
+const double GROWTH_CLASS_MARGIN = 0.25;                          // Past the midpoint between two classes
+const double GROWTH_LINEAR_FROM = 0.5 + GROWTH_CLASS_MARGIN;      // Fitted exponents from here up count as O(n)
+const double GROWTH_QUADRATIC_FROM = 1.5 + GROWTH_CLASS_MARGIN;   // ... and from here up as O(n^2)
+
+// Least-squares slope of log(time) against log(size). Needs two distinct sizes.
+inline double fitGrowthExponent(const vector<double>& sizes, const vector<double>& times) {
+    size_t count = min(sizes.size(), times.size());
+    double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+    int used = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (sizes[i] <= 0 || times[i] <= 0) {
+            continue;
+        }
+        double x = log(sizes[i]);
+        double y = log(times[i]);
+        sumX += x;
+        sumY += y;
+        sumXX += x * x;
+        sumXY += x * y;
+        used++;
+    }
+    double denominator = used * sumXX - sumX * sumX;
+    if (used < 2 || denominator <= 0) {
+        return 0;
+    }
+    return (used * sumXY - sumX * sumY) / denominator;
+}
+
+// 0 = O(1), 1 = O(n), 2 = O(n^2)
+inline int classifyGrowth(double exponent) {
+    if (exponent >= GROWTH_QUADRATIC_FROM) {
+        return 2;
+    }
+    return exponent >= GROWTH_LINEAR_FROM ? 1 : 0;
+}
+
+inline string growthClassName(int growthClass) {
+    static const string names[3] = {"O(1)", "O(n)", "O(n^2)"};
+    return names[max(0, min(growthClass, 2))];
+}
+
+inline int growthClassFromName(const string& name) {
+    for (int growthClass = 0; growthClass < 3; growthClass++) {
+        if (growthClassName(growthClass) == name) {
+            return growthClass;
+        }
+    }
+    return -1;
+}
+
+// Fixed-precision number for JSON output (JSON has no NaN or infinity)
+inline string formatJsonNumber(double value) {
+    if (!isfinite(value)) {
+        return "null";
+    }
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.3f", value);
+    return buffer;
+}
+
+// Quotes and escapes a string for JSON output
+inline string quoteJson(const string& text) {
+    string quoted = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            quoted += '\\';
+            quoted += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char buffer[8];
+            snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned char>(c));
+            quoted += buffer;
+        } else {
+            quoted += c;
+        }
+    }
+    return quoted + "\"";
+}
+
+// Value of "field" in a single-line JSON object written by this harness
+// (a quoted string without escapes, or a number). Returns false if absent.
+inline bool readJsonField(const string& line, const string& field, string& value) {
+    string key = "\"" + field + "\":";
+    size_t position = line.find(key);
+    if (position == string::npos) {
+        return false;
+    }
+    position = line.find_first_not_of(' ', position + key.size());
+    if (position == string::npos) {
+        return false;
+    }
+    if (line[position] == '"') {
+        size_t end = line.find('"', position + 1);
+        if (end == string::npos) {
+            return false;
+        }
+        value = line.substr(position + 1, end - position - 1);
+        return true;
+    }
+    size_t end = line.find_first_of(",}", position);
+    value = line.substr(position, end == string::npos ? string::npos : end - position);
+    return !value.empty();
+}
+
+#endif
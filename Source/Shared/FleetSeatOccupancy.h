@@ -0,0 +1,158 @@
+/*
+===============================================================================
+SHARED FLEET SEAT OCCUPANCY - SIDE INDEXES FOR THE LIST BACKENDS
+===============================================================================
+Used by: Linked List Version (PassengerLinkedList)
+         Unrolled List Version (UnrolledPassengerList)
+
+Both list backends keep their passengers in insertion order and answer every
+seat question from the same side indexes instead of walking their records:
+  - one SeatBitmap per plane number       (is 12C taken on plane 7?)
+  - FleetFreeSeatTree over plane positions (first plane with a free Economy seat)
+  - SeatPositionIndex over plane positions (first plane where 12C is free)
+  - FleetStatistics                        (dashboard totals)
+
+Plane numbers are 1-based as in the CSV, so plane number N sits at position
+N - 1 of the tree, the position index and the statistics.
+===============================================================================
+*/
+
+#ifndef SHARED_FLEET_SEAT_OCCUPANCY_H
+#define SHARED_FLEET_SEAT_OCCUPANCY_H
+
+#include <vector>
+
+#include "SeatBitmap.h"
+#include "FleetSeatTree.h"
+#include "SeatPositionIndex.h"
+#include "FleetStatistics.h"
+
+using namespace std;
+
+class FleetSeatOccupancy {
+private:
+    // Occupied seats, one 180-bit map per plane number
+    vector<SeatBitmap> planeSeatMaps;
+
+    // Free seats per class for every plane position
+    FleetFreeSeatTree freeSeatTree;
+
+    // Per seat position, the plane positions where that seat is taken
+    SeatPositionIndex seatPositionIndex;
+
+    // Running passenger totals (fleet, per class, per plane position)
+    FleetStatistics statistics;
+
+public:
+    void clear() {
+        planeSeatMaps.clear();
+        planeSeatMaps.shrink_to_fit();
+        freeSeatTree.clear();
+        seatPositionIndex.clear();
+        statistics.clear();
+    }
+
+    // Starts tracking plane numbers 1..count (new planes are empty)
+    void ensurePlanes(int count) {
+        if (count > 0) {
+            freeSeatTree.ensurePlanes(count);
+            seatPositionIndex.ensurePlanes(count);
+            statistics.ensurePlanes(count);
+        }
+    }
+
+    void markSeat(int seatRow, int seatColumn, int planeNumber, bool occupied) {
+        int slot = seatSlotIndex(seatRow, seatColumn);
+        if (slot < 0 || planeNumber < 0) {
+            return;
+        }
+        if (planeNumber >= static_cast<int>(planeSeatMaps.size())) {
+            planeSeatMaps.resize(planeNumber + 1);
+        }
+        if (planeSeatMaps[planeNumber].test(slot) == occupied) {
+            return;
+        }
+        if (occupied) {
+            planeSeatMaps[planeNumber].set(slot);
+        } else {
+            planeSeatMaps[planeNumber].clear(slot);
+        }
+
+        if (planeNumber >= 1) {
+            freeSeatTree.ensurePlanes(planeNumber);
+            freeSeatTree.adjustFreeSeats(planeNumber - 1, seatClassOfRow(seatRow), occupied ? -1 : 1);
+            seatPositionIndex.setOccupied(planeNumber - 1, slot, occupied);
+            if (occupied) {
+                statistics.recordSeatTaken(planeNumber - 1, seatClassOfRow(seatRow));
+            } else {
+                statistics.recordSeatFreed(planeNumber - 1, seatClassOfRow(seatRow));
+            }
+        }
+    }
+
+    bool isSeatOccupied(int seatRow, int seatColumn, int planeNumber) const {
+        int slot = seatSlotIndex(seatRow, seatColumn);
+        if (slot < 0 || planeNumber < 0 || planeNumber >= static_cast<int>(planeSeatMaps.size())) {
+            return false;
+        }
+        return planeSeatMaps[planeNumber].test(slot);
+    }
+
+    // First plane number (from 1) where this exact seat is free. Plane numbers past
+    // the tracked range are empty, so the answer is never worse than one past the end.
+    int findFirstPlaneWithSeatFree(int seatRow, int seatColumn) const {
+        int slot = seatSlotIndex(seatRow, seatColumn);
+        if (slot < 0) {
+            return 1;
+        }
+        int position = seatPositionIndex.findFirstPlaneWithSeatFree(slot);
+        if (position >= 0) {
+            return position + 1;
+        }
+        return seatPositionIndex.size() + 1;
+    }
+
+    // Plane numbers (lowest first) where this exact seat is taken
+    vector<int> getPlanesWithSeatOccupied(int seatRow, int seatColumn) const {
+        vector<int> planeNumbers = seatPositionIndex.collectPlanesWithSeatOccupied(seatSlotIndex(seatRow, seatColumn));
+        for (int& planeNumber : planeNumbers) {
+            planeNumber += 1;
+        }
+        return planeNumbers;
+    }
+
+    // First plane number up to maxPlaneNumber with a free seat in the class, or -1.
+    // Plane numbers past the tracked range have nobody on them yet, so they are entirely free.
+    int findFirstPlaneWithFreeSeat(int seatClass, int maxPlaneNumber) const {
+        int position = freeSeatTree.findFirstPlaneWithFreeSeat(seatClass);
+        if (position >= 0) {
+            return (position + 1 <= maxPlaneNumber) ? position + 1 : -1;
+        }
+        if (freeSeatTree.size() < maxPlaneNumber) {
+            return freeSeatTree.size() + 1;
+        }
+        return -1;
+    }
+
+    // Lowest free seat of the class on one plane, in row-major order.
+    bool findFirstFreeSeat(int planeNumber, int seatClass, int& seatRow, int& seatColumn) const {
+        SeatBitmap emptyPlane;
+        const SeatBitmap& seatMap = (planeNumber >= 0 && planeNumber < static_cast<int>(planeSeatMaps.size()))
+            ? planeSeatMaps[planeNumber]
+            : emptyPlane;
+
+        int slot = seatMap.findFirstFree(seatClass);
+        if (slot < 0) {
+            return false;
+        }
+        seatRow = slot / SEAT_BITMAP_COLUMNS;
+        seatColumn = slot % SEAT_BITMAP_COLUMNS;
+        return true;
+    }
+
+    const FleetStatistics& getStatistics() const {
+        return statistics;
+    }
+};
+
+#endif
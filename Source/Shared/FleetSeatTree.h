@@ -0,0 +1,144 @@
+/*
+===============================================================================
+SHARED FLEET FREE-SEAT TREE - FIRST PLANE WITH A FREE SEAT IN O(log P)
+===============================================================================
+Used by: Array Version (auto-assignment, findPlaneWithAvailableSeat)
+         Linked List Version (insertPassengerReservation)
+
+One sum segment tree per cabin class, built over plane positions 0..P-1.
+Each leaf holds the number of free seats of that class on one plane and every
+inner node holds the sum of its children, so:
+  - booking / cancelling a seat updates one leaf and its ancestors, O(log P)
+  - "first plane with a free Business seat" walks down from the root, always
+    taking the left child when it still has a free seat, O(log P)
+  - the root is the fleet-wide free-seat count for that class, O(1)
+
+Planes added to the tree start with every seat free.
+===============================================================================
+*/
+
+#ifndef SHARED_FLEET_SEAT_TREE_H
+#define SHARED_FLEET_SEAT_TREE_H
+
+#include <vector>
+
+#include "SeatBitmap.h"
+
+using namespace std;
+
+class FleetFreeSeatTree {
+private:
+    int leafCount;  // Power of two, always >= planeCount
+    int planeCount; // Planes currently tracked
+    vector<int> freeSeats[SEAT_CLASS_COUNT]; // Heap layout: node i has children 2i and 2i+1
+
+    void updateLeaf(int planePosition, int seatClass, int value) {
+        vector<int>& tree = freeSeats[seatClass];
+        int node = leafCount + planePosition;
+        tree[node] = value;
+        for (node >>= 1; node >= 1; node >>= 1) {
+            tree[node] = tree[2 * node] + tree[2 * node + 1];
+        }
+    }
+
+    // Doubles the leaf level until it fits, keeping the existing leaf values
+    void growLeaves(int requiredPlanes) {
+        int newLeafCount = leafCount;
+        while (newLeafCount < requiredPlanes) {
+            newLeafCount *= 2;
+        }
+        if (newLeafCount == leafCount) {
+            return;
+        }
+
+        for (int seatClass = 0; seatClass < SEAT_CLASS_COUNT; seatClass++) {
+            vector<int> rebuilt(2 * newLeafCount, 0);
+            for (int plane = 0; plane < planeCount; plane++) {
+                rebuilt[newLeafCount + plane] = freeSeats[seatClass][leafCount + plane];
+            }
+            for (int node = newLeafCount - 1; node >= 1; node--) {
+                rebuilt[node] = rebuilt[2 * node] + rebuilt[2 * node + 1];
+            }
+            freeSeats[seatClass].swap(rebuilt);
+        }
+        leafCount = newLeafCount;
+    }
+
+public:
+    FleetFreeSeatTree() : leafCount(1), planeCount(0) {
+        clear();
+    }
+
+    void clear() {
+        leafCount = 1;
+        planeCount = 0;
+        for (int seatClass = 0; seatClass < SEAT_CLASS_COUNT; seatClass++) {
+            freeSeats[seatClass].assign(2, 0);
+        }
+    }
+
+    int size() const {
+        return planeCount;
+    }
+
+    // Starts tracking planes up to position count - 1, each with every seat free
+    void ensurePlanes(int count) {
+        if (count <= planeCount) {
+            return;
+        }
+        growLeaves(count);
+        for (int plane = planeCount; plane < count; plane++) {
+            for (int seatClass = 0; seatClass < SEAT_CLASS_COUNT; seatClass++) {
+                updateLeaf(plane, seatClass, SEAT_CLASS_CAPACITY[seatClass]);
+            }
+        }
+        planeCount = count;
+    }
+
+    void adjustFreeSeats(int planePosition, int seatClass, int delta) {
+        if (planePosition < 0 || planePosition >= planeCount) {
+            return;
+        }
+        updateLeaf(planePosition, seatClass, freeSeats[seatClass][leafCount + planePosition] + delta);
+    }
+
+    int getFreeSeats(int planePosition, int seatClass) const {
+        if (planePosition < 0 || planePosition >= planeCount) {
+            return 0;
+        }
+        return freeSeats[seatClass][leafCount + planePosition];
+    }
+
+    // Fleet-wide number of free seats in one class (root of the tree)
+    int getTotalFreeSeats(int seatClass) const {
+        return freeSeats[seatClass][1];
+    }
+
+    // Lowest plane position with a free seat in the class, or -1 if every plane is full.
+    // SEAT_CLASS_ANY returns the lowest plane with a free seat in any class.
+    int findFirstPlaneWithFreeSeat(int seatClass) const {
+        if (seatClass == SEAT_CLASS_ANY) {
+            int firstPlane = -1;
+            for (int c = 0; c < SEAT_CLASS_COUNT; c++) {
+                int candidate = findFirstPlaneWithFreeSeat(c);
+                if (candidate >= 0 && (firstPlane < 0 || candidate < firstPlane)) {
+                    firstPlane = candidate;
+                }
+            }
+            return firstPlane;
+        }
+
+        const vector<int>& tree = freeSeats[seatClass];
+        if (planeCount == 0 || tree[1] <= 0) {
+            return -1;
+        }
+
+        int node = 1;
+        while (node < leafCount) {
+            node = (tree[2 * node] > 0) ? 2 * node : 2 * node + 1;
+        }
+        return node - leafCount;
+    }
+};
+
+#endif
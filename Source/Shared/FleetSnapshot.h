@@ -0,0 +1,267 @@
+/*
+===============================================================================
+SHARED FLEET SNAPSHOT - BINARY IMAGE OF AN ALREADY-PLACED FLEET
+===============================================================================
+Used by: Array Version (loadPassengerDataFromCSV, savePassengerDataToCSV)
+         Linked List Version (readPassengerCSV, savePassengerCSV)
+
+Loading the CSV means parsing every row and then searching for a plane where
+that exact seat is still free. The snapshot stores the result of that work:
+every passenger already has its plane number and packed seat slot, and every
+ID / name / class string is interned once into a string table.
+
+File layout (native byte order, all sections 4-byte aligned):
+  FleetSnapshotHeader
+  FleetSnapshotRecord  x recordCount   (in the backend's own record order)
+  uint32_t offsets     x stringCount+1 (start of string i, plus the end)
+  char bytes           x stringBytes   (string i = bytes[offsets[i]..offsets[i+1]))
+
+The file is written next to its CSV ("X.csv" -> "X.snapshot") and remembers
+the size and modification time the CSV had at that moment. If the CSV has
+changed since, or the version / layout does not match, the snapshot is stale
+and the caller falls back to the CSV (and writes a fresh snapshot).
+===============================================================================
+*/
+
+#ifndef SHARED_FLEET_SNAPSHOT_H
+#define SHARED_FLEET_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MappedCSVReader.h"
+#include "SeatBitmap.h"
+
+using namespace std;
+
+const char FLEET_SNAPSHOT_MAGIC[8] = {'F', 'L', 'T', 'S', 'N', 'A', 'P', '\0'};
+const uint32_t FLEET_SNAPSHOT_VERSION = 1;
+
+struct FleetSnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t recordSize;     // sizeof(FleetSnapshotRecord) when written, guards layout changes
+    uint64_t sourceSize;     // CSV size in bytes when the snapshot was written
+    int64_t sourceModified;  // CSV modification time (platform ticks) when the snapshot was written
+    uint32_t planeCount;     // Planes in the fleet, including any that are empty
+    uint32_t recordCount;
+    uint32_t stringCount;
+    uint32_t stringBytes;
+};
+
+struct FleetSnapshotRecord {
+    uint32_t passengerIdRef;    // Index into the string table
+    uint32_t passengerNameRef;
+    uint32_t passengerClassRef;
+    uint32_t planeNumber;       // 1-based
+    uint8_t seatSlot;           // row * 6 + column
+    uint8_t padding[3];
+};
+
+// Same file name with another extension: ("...\Data.csv", ".snapshot") -> "...\Data.snapshot"
+inline string replaceFileExtension(const string& filePath, const string& extension) {
+    size_t dot = filePath.find_last_of('.');
+    size_t separator = filePath.find_last_of("/\\");
+    if (dot == string::npos || (separator != string::npos && dot < separator)) {
+        return filePath + extension;
+    }
+    return filePath.substr(0, dot) + extension;
+}
+
+// "...\FlightPassengerDataArray.csv" -> "...\FlightPassengerDataArray.snapshot"
+inline string fleetSnapshotPathFor(const string& csvPath) {
+    return replaceFileExtension(csvPath, ".snapshot");
+}
+
+// Size and last-write time of a file, used to tell whether a snapshot is stale.
+inline bool readFileStamp(const string& filePath, uint64_t& fileSize, int64_t& modified) {
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA fileInfo;
+    if (!GetFileAttributesExA(filePath.c_str(), GetFileExInfoStandard, &fileInfo)) {
+        return false;
+    }
+    fileSize = (static_cast<uint64_t>(fileInfo.nFileSizeHigh) << 32) | fileInfo.nFileSizeLow;
+    modified = static_cast<int64_t>((static_cast<uint64_t>(fileInfo.ftLastWriteTime.dwHighDateTime) << 32) |
+                                    fileInfo.ftLastWriteTime.dwLowDateTime);
+#else
+    struct stat fileInfo;
+    if (stat(filePath.c_str(), &fileInfo) != 0) {
+        return false;
+    }
+    fileSize = static_cast<uint64_t>(fileInfo.st_size);
+#ifdef __APPLE__
+    modified = static_cast<int64_t>(fileInfo.st_mtimespec.tv_sec) * 1000000000LL + fileInfo.st_mtimespec.tv_nsec;
+#else
+    modified = static_cast<int64_t>(fileInfo.st_mtim.tv_sec) * 1000000000LL + fileInfo.st_mtim.tv_nsec;
+#endif
+#endif
+    return true;
+}
+
+// Collects records in memory, interning every string, then writes the file in one go.
+class FleetSnapshotWriter {
+private:
+    vector<FleetSnapshotRecord> records;
+    vector<uint32_t> stringOffsets;
+    string stringBytes;
+    unordered_map<string, uint32_t> internedStrings;
+
+    uint32_t intern(const string& text) {
+        auto found = internedStrings.find(text);
+        if (found != internedStrings.end()) {
+            return found->second;
+        }
+        uint32_t ref = static_cast<uint32_t>(stringOffsets.size());
+        stringOffsets.push_back(static_cast<uint32_t>(stringBytes.size()));
+        stringBytes.append(text);
+        internedStrings.emplace(text, ref);
+        return ref;
+    }
+
+public:
+    void reserve(size_t recordCount) {
+        records.reserve(recordCount);
+    }
+
+    void addRecord(const string& passengerId, const string& passengerName, const string& passengerClass,
+                   int planeNumber, int seatSlot) {
+        FleetSnapshotRecord record{};
+        record.passengerIdRef = intern(passengerId);
+        record.passengerNameRef = intern(passengerName);
+        record.passengerClassRef = intern(passengerClass);
+        record.planeNumber = static_cast<uint32_t>(planeNumber);
+        record.seatSlot = static_cast<uint8_t>(seatSlot);
+        records.push_back(record);
+    }
+
+    // Writes to a temporary file and renames it over the old snapshot, so a
+    // crash half way through never leaves a truncated snapshot behind.
+    bool writeFile(const string& snapshotPath, const string& sourcePath, int planeCount) const {
+        FleetSnapshotHeader header{};
+        memcpy(header.magic, FLEET_SNAPSHOT_MAGIC, sizeof(header.magic));
+        header.version = FLEET_SNAPSHOT_VERSION;
+        header.recordSize = sizeof(FleetSnapshotRecord);
+        if (!readFileStamp(sourcePath, header.sourceSize, header.sourceModified)) {
+            return false;
+        }
+        header.planeCount = static_cast<uint32_t>(planeCount);
+        header.recordCount = static_cast<uint32_t>(records.size());
+        header.stringCount = static_cast<uint32_t>(stringOffsets.size());
+        header.stringBytes = static_cast<uint32_t>(stringBytes.size());
+
+        // The end offset of the last string closes the offset table
+        uint32_t endOffset = header.stringBytes;
+
+        string temporaryPath = snapshotPath + ".tmp";
+        {
+            ofstream snapshotFile(temporaryPath, ios::binary | ios::trunc);
+            if (!snapshotFile.is_open()) {
+                return false;
+            }
+            snapshotFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            snapshotFile.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(FleetSnapshotRecord));
+            snapshotFile.write(reinterpret_cast<const char*>(stringOffsets.data()), stringOffsets.size() * sizeof(uint32_t));
+            snapshotFile.write(reinterpret_cast<const char*>(&endOffset), sizeof(endOffset));
+            snapshotFile.write(stringBytes.data(), stringBytes.size());
+            if (!snapshotFile.good()) {
+                snapshotFile.close();
+                remove(temporaryPath.c_str());
+                return false;
+            }
+        }
+
+        remove(snapshotPath.c_str()); // rename() does not replace an existing file on Windows
+        return rename(temporaryPath.c_str(), snapshotPath.c_str()) == 0;
+    }
+};
+
+// Maps a snapshot and resolves its sections in place. Records and strings are
+// read straight out of the mapping and stay valid while the reader is open.
+class FleetSnapshotReader {
+private:
+    MappedFile snapshotFile;
+    FleetSnapshotHeader header;
+    const FleetSnapshotRecord* records;
+    const uint32_t* stringOffsets;
+    const char* stringBytes;
+
+public:
+    FleetSnapshotReader() : header{}, records(nullptr), stringOffsets(nullptr), stringBytes(nullptr) {}
+
+    // Returns false when the snapshot is missing, malformed or older than sourcePath.
+    bool open(const string& snapshotPath, const string& sourcePath) {
+        uint64_t sourceSize = 0;
+        int64_t sourceModified = 0;
+        if (!readFileStamp(sourcePath, sourceSize, sourceModified) || !snapshotFile.open(snapshotPath)) {
+            return false;
+        }
+
+        string_view contents = snapshotFile.contents();
+        if (contents.size() < sizeof(header)) {
+            return false;
+        }
+        memcpy(&header, contents.data(), sizeof(header));
+        if (memcmp(header.magic, FLEET_SNAPSHOT_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != FLEET_SNAPSHOT_VERSION ||
+            header.recordSize != sizeof(FleetSnapshotRecord) ||
+            header.sourceSize != sourceSize ||
+            header.sourceModified != sourceModified) {
+            return false;
+        }
+
+        uint64_t recordsBytes = static_cast<uint64_t>(header.recordCount) * sizeof(FleetSnapshotRecord);
+        uint64_t offsetsBytes = (static_cast<uint64_t>(header.stringCount) + 1) * sizeof(uint32_t);
+        if (sizeof(header) + recordsBytes + offsetsBytes + header.stringBytes != contents.size()) {
+            return false;
+        }
+
+        // Pointer fix-up: each section starts where the previous one ends
+        const char* base = contents.data();
+        records = reinterpret_cast<const FleetSnapshotRecord*>(base + sizeof(header));
+        stringOffsets = reinterpret_cast<const uint32_t*>(base + sizeof(header) + recordsBytes);
+        stringBytes = base + sizeof(header) + recordsBytes + offsetsBytes;
+
+        // Validate once here so the loaders can trust every record
+        for (uint32_t i = 0; i < header.stringCount; i++) {
+            if (stringOffsets[i] > stringOffsets[i + 1]) {
+                return false;
+            }
+        }
+        if (stringOffsets[header.stringCount] != header.stringBytes) {
+            return false;
+        }
+        for (uint32_t i = 0; i < header.recordCount; i++) {
+            const FleetSnapshotRecord& record = records[i];
+            if (record.passengerIdRef >= header.stringCount || record.passengerNameRef >= header.stringCount ||
+                record.passengerClassRef >= header.stringCount || record.seatSlot >= SEAT_BITMAP_SEATS ||
+                record.planeNumber < 1 || record.planeNumber > header.planeCount) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int getPlaneCount() const {
+        return static_cast<int>(header.planeCount);
+    }
+
+    int getRecordCount() const {
+        return static_cast<int>(header.recordCount);
+    }
+
+    const FleetSnapshotRecord& getRecord(int index) const {
+        return records[index];
+    }
+
+    string_view getString(uint32_t ref) const {
+        return string_view(stringBytes + stringOffsets[ref], stringOffsets[ref + 1] - stringOffsets[ref]);
+    }
+};
+
+#endif
@@ -0,0 +1,97 @@
+/*
+===============================================================================
+SHARED FLEET STATISTICS - RUNNING COUNTERS FOR THE DASHBOARD
+===============================================================================
+Used by: Array Version (allocateSeat / deallocateSeat, createNewPlane)
+         Linked List Version (markSeat, setTotalPlanes)
+         Main.cpp performance dashboard
+
+Totals that used to be recomputed by walking every plane (or every node) are
+kept up to date on each booking and cancellation instead:
+  - passengers in the whole fleet, per cabin class and per plane
+  - number of planes
+Free-seat figures follow from the plane count and the fixed class capacities,
+so every query here is O(1).
+===============================================================================
+*/
+
+#ifndef SHARED_FLEET_STATISTICS_H
+#define SHARED_FLEET_STATISTICS_H
+
+#include <vector>
+
+#include "SeatBitmap.h"
+
+using namespace std;
+
+class FleetStatistics {
+private:
+    int totalPassengers;
+    int passengersInClass[SEAT_CLASS_COUNT];
+    vector<int> passengersOnPlane; // Indexed by plane position (0-based)
+
+public:
+    FleetStatistics() {
+        clear();
+    }
+
+    void clear() {
+        totalPassengers = 0;
+        for (int seatClass = 0; seatClass < SEAT_CLASS_COUNT; seatClass++) {
+            passengersInClass[seatClass] = 0;
+        }
+        passengersOnPlane.clear();
+    }
+
+    // Starts counting planes up to position count - 1 (new planes are empty)
+    void ensurePlanes(int count) {
+        if (count > static_cast<int>(passengersOnPlane.size())) {
+            passengersOnPlane.resize(count, 0);
+        }
+    }
+
+    void recordSeatTaken(int planePosition, int seatClass) {
+        ensurePlanes(planePosition + 1);
+        totalPassengers++;
+        passengersInClass[seatClass]++;
+        passengersOnPlane[planePosition]++;
+    }
+
+    void recordSeatFreed(int planePosition, int seatClass) {
+        if (planePosition < 0 || planePosition >= static_cast<int>(passengersOnPlane.size())) {
+            return;
+        }
+        totalPassengers--;
+        passengersInClass[seatClass]--;
+        passengersOnPlane[planePosition]--;
+    }
+
+    int getPlaneCount() const {
+        return static_cast<int>(passengersOnPlane.size());
+    }
+
+    int getTotalPassengers() const {
+        return totalPassengers;
+    }
+
+    int getPassengersInClass(int seatClass) const {
+        return passengersInClass[seatClass];
+    }
+
+    int getPassengersOnPlane(int planePosition) const {
+        if (planePosition < 0 || planePosition >= static_cast<int>(passengersOnPlane.size())) {
+            return 0;
+        }
+        return passengersOnPlane[planePosition];
+    }
+
+    int getTotalAvailableSeats() const {
+        return getPlaneCount() * SEAT_BITMAP_SEATS - totalPassengers;
+    }
+
+    int getAvailableSeatsInClass(int seatClass) const {
+        return getPlaneCount() * SEAT_CLASS_CAPACITY[seatClass] - passengersInClass[seatClass];
+    }
+};
+
+#endif
@@ -0,0 +1,268 @@
+/*
+===============================================================================
+SHARED HARDWARE COUNTERS - PERF_EVENT_OPEN AROUND TIMED SECTIONS
+===============================================================================
+Used by: Joint program (Main.cpp) - every timed operation and load
+
+Wall time says which backend is faster; the CPU's counters say why. Each
+thread opens one perf_event group counting, in user space only:
+
+  cycles, instructions, L1D read misses, LLC misses, branch misses
+
+and leaves it running. A timed section reads the group once before the
+clock starts and once after it stops, so nested sections work and the
+reads add nothing to the measured time:
+
+  HardwareCounterSection counters;
+  auto start = chrono::high_resolution_clock::now();
+  ...
+  auto end = chrono::high_resolution_clock::now();
+  view.counters = counters.stop();
+
+Counts cover the calling thread only, not threads it starts. If the kernel
+multiplexed the group (time running < time enabled) the counts are scaled
+up to the whole section.
+
+The layer is off until enableHardwareCounters() is called, so code timing
+many calls in a loop (the benchmark) pays nothing. When perf_event_open is
+missing or refused - non-Linux builds, containers without a PMU, a strict
+perf_event_paranoid - readings come back with available = false and
+hardwareCountersStatus() says why. Counters the CPU lacks are left out
+individually.
+===============================================================================
+*/
+
+#ifndef SHARED_HARDWARE_COUNTERS_H
+#define SHARED_HARDWARE_COUNTERS_H
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+enum HardwareCounter {
+    HARDWARE_CYCLES = 0,
+    HARDWARE_INSTRUCTIONS,
+    HARDWARE_L1D_MISSES,
+    HARDWARE_LLC_MISSES,
+    HARDWARE_BRANCH_MISSES,
+    HARDWARE_COUNTER_COUNT
+};
+
+struct HardwareCounterReading {
+    bool available = false;                            // False: nothing was counted
+    bool present[HARDWARE_COUNTER_COUNT] = {};         // Which counters this CPU provides
+    uint64_t values[HARDWARE_COUNTER_COUNT] = {};
+};
+
+inline bool hardwareCountersEnabled = false;
+
+class HardwareCounterGroup {
+private:
+    int leaderFd;
+    int memberCount;                             // Counters opened, in HardwareCounter order
+    HardwareCounter members[HARDWARE_COUNTER_COUNT];
+    int fds[HARDWARE_COUNTER_COUNT];
+    string failure;                              // Why no counter could be opened
+
+#ifdef __linux__
+    static bool describeEvent(HardwareCounter counter, perf_event_attr& attr) {
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        switch (counter) {
+            case HARDWARE_CYCLES:
+                attr.config = PERF_COUNT_HW_CPU_CYCLES;
+                break;
+            case HARDWARE_INSTRUCTIONS:
+                attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+                break;
+            case HARDWARE_L1D_MISSES:
+                attr.type = PERF_TYPE_HW_CACHE;
+                attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                              (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+                break;
+            case HARDWARE_LLC_MISSES:
+                attr.config = PERF_COUNT_HW_CACHE_MISSES;
+                break;
+            case HARDWARE_BRANCH_MISSES:
+                attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+                break;
+            default:
+                return false;
+        }
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return true;
+    }
+#endif
+
+public:
+    // Raw group values plus the times the group was enabled and running
+    struct Snapshot {
+        bool valid = false;
+        uint64_t enabledNs = 0;
+        uint64_t runningNs = 0;
+        uint64_t values[HARDWARE_COUNTER_COUNT] = {};
+    };
+
+    HardwareCounterGroup() : leaderFd(-1), memberCount(0) {
+#ifdef __linux__
+        int firstError = 0;
+        for (int counter = 0; counter < HARDWARE_COUNTER_COUNT; counter++) {
+            perf_event_attr attr;
+            describeEvent(static_cast<HardwareCounter>(counter), attr);
+            attr.disabled = leaderFd < 0 ? 1 : 0; // The leader starts the whole group
+            int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, leaderFd, 0));
+            if (fd < 0) {
+                firstError = firstError != 0 ? firstError : errno;
+                continue;
+            }
+            if (leaderFd < 0) {
+                leaderFd = fd;
+            }
+            members[memberCount] = static_cast<HardwareCounter>(counter);
+            fds[memberCount++] = fd;
+        }
+        if (leaderFd < 0) {
+            failure = string("perf_event_open: ") + strerror(firstError);
+            return;
+        }
+        if (ioctl(leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) {
+            failure = string("perf_event enable: ") + strerror(errno);
+            closeAll();
+        }
+#else
+        failure = "perf_event_open is Linux only";
+#endif
+    }
+
+    ~HardwareCounterGroup() {
+        closeAll();
+    }
+
+    HardwareCounterGroup(const HardwareCounterGroup&) = delete;
+    HardwareCounterGroup& operator=(const HardwareCounterGroup&) = delete;
+
+    void closeAll() {
+#ifdef __linux__
+        for (int i = 0; i < memberCount; i++) {
+            close(fds[i]);
+        }
+#endif
+        leaderFd = -1;
+        memberCount = 0;
+    }
+
+    bool isOpen() const {
+        return leaderFd >= 0;
+    }
+
+    const string& getFailure() const {
+        return failure;
+    }
+
+    int getMemberCount() const {
+        return memberCount;
+    }
+
+    HardwareCounter getMember(int index) const {
+        return members[index];
+    }
+
+    Snapshot read() const {
+        Snapshot snapshot;
+#ifdef __linux__
+        if (leaderFd < 0) {
+            return snapshot;
+        }
+        // nr, time_enabled, time_running, then one value per member
+        uint64_t buffer[3 + HARDWARE_COUNTER_COUNT];
+        ssize_t expected = static_cast<ssize_t>((3 + memberCount) * sizeof(uint64_t));
+        if (::read(leaderFd, buffer, sizeof(buffer)) != expected || buffer[0] != static_cast<uint64_t>(memberCount)) {
+            return snapshot;
+        }
+        snapshot.valid = true;
+        snapshot.enabledNs = buffer[1];
+        snapshot.runningNs = buffer[2];
+        for (int i = 0; i < memberCount; i++) {
+            snapshot.values[i] = buffer[3 + i];
+        }
+#endif
+        return snapshot;
+    }
+};
+
+// This thread's group, opened on first use
+inline HardwareCounterGroup& threadHardwareCounters() {
+    static thread_local HardwareCounterGroup group;
+    return group;
+}
+
+inline void enableHardwareCounters() {
+    hardwareCountersEnabled = true;
+}
+
+// "cycles, instructions, ..." when counting, otherwise why not
+inline string hardwareCountersStatus() {
+    static const char* const names[HARDWARE_COUNTER_COUNT] = {
+        "cycles", "instructions", "L1D misses", "LLC misses", "branch misses"
+    };
+    if (!hardwareCountersEnabled) {
+        return "off";
+    }
+    HardwareCounterGroup& group = threadHardwareCounters();
+    if (!group.isOpen()) {
+        return "unavailable (" + group.getFailure() + ")";
+    }
+    string status;
+    for (int i = 0; i < group.getMemberCount(); i++) {
+        status += (i > 0 ? ", " : "") + string(names[group.getMember(i)]);
+    }
+    return status;
+}
+
+class HardwareCounterSection {
+public:
+    HardwareCounterSection() {
+        if (hardwareCountersEnabled) {
+            start = threadHardwareCounters().read();
+        }
+    }
+
+    HardwareCounterReading stop() const {
+        HardwareCounterReading reading;
+        if (!start.valid) {
+            return reading;
+        }
+        const HardwareCounterGroup& group = threadHardwareCounters();
+        HardwareCounterGroup::Snapshot end = group.read();
+        if (!end.valid || end.runningNs <= start.runningNs) {
+            return reading; // Never scheduled during the section
+        }
+        double scale = static_cast<double>(end.enabledNs - start.enabledNs) /
+                       static_cast<double>(end.runningNs - start.runningNs);
+        reading.available = true;
+        for (int i = 0; i < group.getMemberCount(); i++) {
+            HardwareCounter counter = group.getMember(i);
+            reading.present[counter] = true;
+            reading.values[counter] = static_cast<uint64_t>(static_cast<double>(end.values[i] - start.values[i]) * scale);
+        }
+        return reading;
+    }
+
+private:
+    HardwareCounterGroup::Snapshot start;
+};
+
+#endif
@@ -0,0 +1,256 @@
+/*
+===============================================================================
+SHARED CSV READER - MEMORY-MAPPED PASSENGER FILE SCANNER
+===============================================================================
+Used by: Array Version (loadPassengerDataFromCSV)
+         Linked List Version (readPassengerCSV)
+
+The passenger CSV is mapped into memory once and scanned in place. Every field
+is handed to the caller as a string_view into the mapping and the seat row is
+converted with from_chars, so no per-row strings or streams are created here.
+
+CSV layout: PassengerID,Name,SeatRow,SeatColumn,Class (first line is a header)
+===============================================================================
+*/
+
+#ifndef SHARED_MAPPED_CSV_READER_H
+#define SHARED_MAPPED_CSV_READER_H
+
+#include <string>
+#include <string_view>
+#include <charconv>
+#include <cstddef>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// One passenger row as it appears in the file. All views point into the mapping
+// and are only valid while the MappedFile that produced them is still open.
+struct PassengerCSVRecord {
+    string_view passengerId;
+    string_view passengerName;
+    int seatRow;           // 1-based, exactly as written in the CSV
+    char seatColumnLetter; // Raw first character of the SeatColumn field
+    string_view passengerClass;
+};
+
+// Read-only view of a whole file. Closed automatically when it goes out of scope.
+class MappedFile {
+private:
+    const char* fileData;
+    size_t fileSize;
+    bool missing;          // The last open() failed because the file does not exist
+#ifdef _WIN32
+    HANDLE fileHandle;
+    HANDLE mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+
+public:
+    MappedFile() : fileData(nullptr), fileSize(0), missing(false) {
+#ifdef _WIN32
+        fileHandle = INVALID_HANDLE_VALUE;
+        mappingHandle = nullptr;
+#else
+        fileDescriptor = -1;
+#endif
+    }
+
+    ~MappedFile() {
+        close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const string& filePath) {
+        close();
+        missing = false;
+
+#ifdef _WIN32
+        fileHandle = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) {
+            missing = GetLastError() == ERROR_FILE_NOT_FOUND;
+            return false;
+        }
+
+        LARGE_INTEGER sizeOnDisk;
+        if (!GetFileSizeEx(fileHandle, &sizeOnDisk)) {
+            close();
+            return false;
+        }
+        fileSize = static_cast<size_t>(sizeOnDisk.QuadPart);
+        if (fileSize == 0) {
+            return true; // Nothing to map, but the file exists
+        }
+
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr) {
+            close();
+            return false;
+        }
+        fileData = static_cast<const char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+        fileDescriptor = ::open(filePath.c_str(), O_RDONLY);
+        if (fileDescriptor < 0) {
+            missing = errno == ENOENT;
+            return false;
+        }
+
+        struct stat fileInfo;
+        if (fstat(fileDescriptor, &fileInfo) != 0) {
+            close();
+            return false;
+        }
+        fileSize = static_cast<size_t>(fileInfo.st_size);
+        if (fileSize == 0) {
+            return true; // Nothing to map, but the file exists
+        }
+
+        void* mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mapping == MAP_FAILED) {
+            close();
+            return false;
+        }
+        madvise(mapping, fileSize, MADV_SEQUENTIAL);
+        fileData = static_cast<const char*>(mapping);
+#endif
+
+        if (fileData == nullptr) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    void close() {
+#ifdef _WIN32
+        if (fileData != nullptr) UnmapViewOfFile(fileData);
+        if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (fileData != nullptr) munmap(const_cast<char*>(fileData), fileSize);
+        if (fileDescriptor >= 0) ::close(fileDescriptor);
+        fileDescriptor = -1;
+#endif
+        fileData = nullptr;
+        fileSize = 0;
+    }
+
+    // True only when the file is absent. Any other failure (permissions, a
+    // sharing violation, a failed mapping) means the file exists and must not
+    // be replaced.
+    bool isMissing() const {
+        return missing;
+    }
+
+    string_view contents() const {
+        if (fileData == nullptr) {
+            return string_view();
+        }
+        return string_view(fileData, fileSize);
+    }
+};
+
+// Trims spaces and tabs from both ends of a field without copying it.
+inline string_view trimCSVField(string_view field) {
+    while (!field.empty() && (field.front() == ' ' || field.front() == '\t')) field.remove_prefix(1);
+    while (!field.empty() && (field.back() == ' ' || field.back() == '\t')) field.remove_suffix(1);
+    return field;
+}
+
+// Splits one line into a PassengerCSVRecord. Returns false for lines that do not
+// have all five fields or whose seat row is not a number.
+inline bool parsePassengerCSVLine(string_view line, PassengerCSVRecord& record) {
+    size_t commaIndex[4];
+    size_t searchFrom = 0;
+    for (int i = 0; i < 4; i++) {
+        commaIndex[i] = line.find(',', searchFrom);
+        if (commaIndex[i] == string_view::npos) {
+            return false;
+        }
+        searchFrom = commaIndex[i] + 1;
+    }
+
+    record.passengerId = line.substr(0, commaIndex[0]);
+    record.passengerName = line.substr(commaIndex[0] + 1, commaIndex[1] - commaIndex[0] - 1);
+    string_view seatRowField = trimCSVField(line.substr(commaIndex[1] + 1, commaIndex[2] - commaIndex[1] - 1));
+    string_view seatColumnField = line.substr(commaIndex[2] + 1, commaIndex[3] - commaIndex[2] - 1);
+    record.passengerClass = line.substr(commaIndex[3] + 1);
+
+    if (seatRowField.empty() || seatColumnField.empty()) {
+        return false;
+    }
+
+    const char* rowBegin = seatRowField.data();
+    if (*rowBegin == '+') {
+        rowBegin++;
+    }
+    auto parsed = from_chars(rowBegin, seatRowField.data() + seatRowField.size(), record.seatRow);
+    if (parsed.ec != errc()) {
+        return false;
+    }
+
+    record.seatColumnLetter = seatColumnField[0];
+    return true;
+}
+
+// Walks every data row of an already-mapped CSV and calls onRecord(record) for
+// each one that parses. The header line is skipped. The callback returns false
+// to stop the scan early. Returns the number of rows handed to the callback.
+template <typename RecordCallback>
+int scanPassengerCSV(string_view contents, RecordCallback onRecord) {
+    size_t position = contents.find('\n');
+    if (position == string_view::npos) {
+        return 0; // Header only (or empty file)
+    }
+    position++;
+
+    int recordsScanned = 0;
+    PassengerCSVRecord record;
+
+    while (position < contents.size()) {
+        size_t lineEnd = contents.find('\n', position);
+        if (lineEnd == string_view::npos) {
+            lineEnd = contents.size();
+        }
+
+        string_view line = contents.substr(position, lineEnd - position);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        position = lineEnd + 1;
+
+        if (line.empty() || !parsePassengerCSVLine(line, record)) {
+            continue;
+        }
+
+        recordsScanned++;
+        if (!onRecord(record)) {
+            break;
+        }
+    }
+
+    return recordsScanned;
+}
+
+#endif
@@ -0,0 +1,229 @@
+/*
+===============================================================================
+SHARED MEMORY ACCOUNTING - COUNTING OPERATOR NEW, TAGGED PER BACKEND
+===============================================================================
+Used by: Joint program (Main.cpp) - performance dashboard
+
+sizeof-based estimates miss every heap buffer behind a string or vector and
+whatever the allocator adds to each block. This header replaces the global
+operator new / operator delete so every allocation is counted against the
+backend that made it:
+
+  MemoryTagScope scope(MEMORY_TAG_ARRAY);   // allocations on this thread
+  ...                                       // now count against the Array
+  MemoryUsage usage = readMemoryUsage(MEMORY_TAG_ARRAY);
+
+The tag is per thread, so the Array can load on a worker thread while the
+lists load on the main thread. Each block carries a small header recording
+its size and tag, so freeing it (on any thread, under any tag) takes it off
+the backend that allocated it. Sizes are the allocator's usable size where
+the platform reports one (glibc, Windows), so rounding and padding inside
+the block are included; the counting header itself is not.
+
+readProcessMemory() adds the process-wide resident set size and its peak
+from /proc/self/status (Linux only; it returns false elsewhere).
+
+The replacement operators are ordinary (non-inline) definitions, so this
+header must be included by exactly one translation unit.
+===============================================================================
+*/
+
+#ifndef SHARED_MEMORY_ACCOUNTING_H
+#define SHARED_MEMORY_ACCOUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#elif defined(_WIN32)
+#include <malloc.h>
+#endif
+
+using namespace std;
+
+enum MemoryTag {
+    MEMORY_TAG_OTHER = 0,  // Menus, temporaries and anything outside a backend
+    MEMORY_TAG_LINKED_LIST,
+    MEMORY_TAG_UNROLLED_LIST,
+    MEMORY_TAG_ARRAY,
+    MEMORY_TAG_COUNT
+};
+
+struct MemoryUsage {
+    size_t liveBytes = 0;        // Bytes currently allocated
+    size_t liveBlocks = 0;       // Allocations not yet freed
+    size_t totalAllocations = 0; // Allocations ever made
+};
+
+struct MemoryTagCounters {
+    atomic<long long> liveBytes;
+    atomic<long long> liveBlocks;
+    atomic<long long> totalAllocations;
+};
+
+// Zero-initialized before any code runs, so allocations made during static
+// initialization are counted too
+inline MemoryTagCounters memoryTagCounters[MEMORY_TAG_COUNT];
+inline thread_local MemoryTag currentMemoryTag = MEMORY_TAG_OTHER;
+
+// Sets this thread's tag for the lifetime of the scope
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(MemoryTag tag) : previous(currentMemoryTag) {
+        currentMemoryTag = tag;
+    }
+
+    ~MemoryTagScope() {
+        currentMemoryTag = previous;
+    }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag previous;
+};
+
+inline MemoryUsage readMemoryUsage(MemoryTag tag) {
+    MemoryUsage usage;
+    const MemoryTagCounters& counters = memoryTagCounters[tag];
+    usage.liveBytes = static_cast<size_t>(max(0LL, counters.liveBytes.load(memory_order_relaxed)));
+    usage.liveBlocks = static_cast<size_t>(max(0LL, counters.liveBlocks.load(memory_order_relaxed)));
+    usage.totalAllocations = static_cast<size_t>(counters.totalAllocations.load(memory_order_relaxed));
+    return usage;
+}
+
+// Resident set size now and at its peak, from /proc/self/status (VmRSS, VmHWM)
+inline bool readProcessMemory(size_t& residentBytes, size_t& peakResidentBytes) {
+    ifstream status("/proc/self/status");
+    if (!status.is_open()) {
+        return false;
+    }
+    bool foundResident = false;
+    bool foundPeak = false;
+    string line;
+    while (getline(status, line)) {
+        bool isResident = line.compare(0, 6, "VmRSS:") == 0;
+        bool isPeak = line.compare(0, 6, "VmHWM:") == 0;
+        if (!isResident && !isPeak) {
+            continue;
+        }
+        size_t kilobytes = strtoull(line.c_str() + 6, nullptr, 10);
+        if (isResident) {
+            residentBytes = kilobytes * 1024;
+            foundResident = true;
+        } else {
+            peakResidentBytes = kilobytes * 1024;
+            foundPeak = true;
+        }
+    }
+    return foundResident && foundPeak;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Replacement operator new / operator delete
+// ────────────────────────────────────────────────────────────────────────────
+
+// Sits in front of every block; padded so the caller's pointer keeps
+// malloc's alignment
+struct alignas(alignof(max_align_t)) MemoryBlockHeader {
+    size_t bytes;
+    MemoryTag tag;
+};
+
+inline void* allocateCounted(size_t size) {
+    void* block;
+    while ((block = malloc(sizeof(MemoryBlockHeader) + size)) == nullptr) {
+        new_handler handler = get_new_handler();
+        if (handler == nullptr) {
+            return nullptr;
+        }
+        handler();
+    }
+
+#if defined(__GLIBC__)
+    size_t bytes = malloc_usable_size(block) - sizeof(MemoryBlockHeader);
+#elif defined(_WIN32)
+    size_t bytes = _msize(block) - sizeof(MemoryBlockHeader);
+#else
+    size_t bytes = size;
+#endif
+    MemoryBlockHeader* header = static_cast<MemoryBlockHeader*>(block);
+    header->bytes = bytes;
+    header->tag = currentMemoryTag;
+
+    MemoryTagCounters& counters = memoryTagCounters[header->tag];
+    counters.liveBytes.fetch_add(static_cast<long long>(bytes), memory_order_relaxed);
+    counters.liveBlocks.fetch_add(1, memory_order_relaxed);
+    counters.totalAllocations.fetch_add(1, memory_order_relaxed);
+    return header + 1;
+}
+
+inline void freeCounted(void* pointer) noexcept {
+    if (pointer == nullptr) {
+        return;
+    }
+    MemoryBlockHeader* header = static_cast<MemoryBlockHeader*>(pointer) - 1;
+    MemoryTagCounters& counters = memoryTagCounters[header->tag];
+    counters.liveBytes.fetch_sub(static_cast<long long>(header->bytes), memory_order_relaxed);
+    counters.liveBlocks.fetch_sub(1, memory_order_relaxed);
+    free(header);
+}
+
+// Over-aligned allocations (operator new with align_val_t) keep the standard
+// library's implementation and are not counted; nothing here allocates them.
+void* operator new(size_t size) {
+    void* pointer = allocateCounted(size);
+    if (pointer == nullptr) {
+        throw bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new[](size_t size) {
+    void* pointer = allocateCounted(size);
+    if (pointer == nullptr) {
+        throw bad_alloc();
+    }
+    return pointer;
+}
+
+void* operator new(size_t size, const nothrow_t&) noexcept {
+    return allocateCounted(size);
+}
+
+void* operator new[](size_t size, const nothrow_t&) noexcept {
+    return allocateCounted(size);
+}
+
+void operator delete(void* pointer) noexcept {
+    freeCounted(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+    freeCounted(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+    freeCounted(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+    freeCounted(pointer);
+}
+
+void operator delete(void* pointer, const nothrow_t&) noexcept {
+    freeCounted(pointer);
+}
+
+void operator delete[](void* pointer, const nothrow_t&) noexcept {
+    freeCounted(pointer);
+}
+
+#endif
@@ -0,0 +1,216 @@
+/*
+===============================================================================
+SHARED NODE POOL - SLAB ALLOCATOR WITH A FREE LIST FOR LIST NODES
+===============================================================================
+Used by: Linked List Version (PassengerLinkedList nodes)
+
+Nodes are carved out of slabs of NODE_POOL_SLAB_SIZE slots instead of one
+heap allocation each. A list loaded from the CSV therefore sits in a few
+contiguous blocks in load order, and walking it touches memory sequentially
+instead of hopping around the heap.
+
+  allocate(...)  : reuses the most recently released slot, otherwise takes the
+                   next unused slot of the last slab (adding a slab when full)
+  release(node)  : destroys the node and pushes its slot on the free list
+  clear()        : destroys every live node and frees all slabs at once
+  isLive(node)   : whether an address still holds a node (used to check handles)
+
+Each slab keeps a bitmap of which slots hold a live node, so clear() and the
+destructor can tear everything down in one sequential pass without the list
+having to walk its nodes first. release() finds a node's slab by binary
+search over the slab addresses.
+===============================================================================
+*/
+
+#ifndef SHARED_NODE_POOL_H
+#define SHARED_NODE_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "SeatBitmap.h"
+
+using namespace std;
+
+const int NODE_POOL_SLAB_SIZE = 1024; // Slots per slab (multiple of 64)
+
+template <typename Node>
+class NodePool {
+private:
+    // A free slot reuses its own storage to link to the next free slot
+    union Slot {
+        Slot* nextFree;
+        alignas(Node) unsigned char storage[sizeof(Node)];
+    };
+
+    struct Slab {
+        unique_ptr<Slot[]> slots;
+        uint64_t liveBits[NODE_POOL_SLAB_SIZE / 64];
+    };
+
+    vector<Slab> slabs;
+    vector<pair<const Slot*, size_t>> slabsByAddress; // (first slot, slab index), sorted by address
+    Slot* freeList;
+    int usedInLastSlab; // Slots of the last slab handed out at least once
+    size_t liveNodes;
+
+    // Finds the slab and slot index of a node by address, O(log slabs)
+    bool locate(const Node* node, size_t& slabIndex, int& slotIndex) const {
+        const Slot* slot = reinterpret_cast<const Slot*>(node);
+        auto after = upper_bound(slabsByAddress.begin(), slabsByAddress.end(), slot,
+                                 [](const Slot* address, const pair<const Slot*, size_t>& entry) {
+                                     return less<const Slot*>()(address, entry.first);
+                                 });
+        if (after == slabsByAddress.begin()) {
+            return false;
+        }
+        --after;
+        if (slot >= after->first + NODE_POOL_SLAB_SIZE) {
+            return false;
+        }
+        slabIndex = after->second;
+        slotIndex = static_cast<int>(slot - after->first);
+        return true;
+    }
+
+    void markLive(size_t slabIndex, int slotIndex, bool live) {
+        uint64_t bit = 1ULL << (slotIndex & 63);
+        if (live) {
+            slabs[slabIndex].liveBits[slotIndex >> 6] |= bit;
+        } else {
+            slabs[slabIndex].liveBits[slotIndex >> 6] &= ~bit;
+        }
+    }
+
+    Slot* takeSlot(size_t& slabIndex, int& slotIndex) {
+        if (freeList != nullptr) {
+            Slot* slot = freeList;
+            freeList = slot->nextFree;
+            locate(reinterpret_cast<Node*>(slot), slabIndex, slotIndex);
+            return slot;
+        }
+        if (slabs.empty() || usedInLastSlab == NODE_POOL_SLAB_SIZE) {
+            Slab slab;
+            slab.slots.reset(new Slot[NODE_POOL_SLAB_SIZE]);
+            for (uint64_t& word : slab.liveBits) {
+                word = 0;
+            }
+            pair<const Slot*, size_t> entry(slab.slots.get(), slabs.size());
+            slabsByAddress.insert(upper_bound(slabsByAddress.begin(), slabsByAddress.end(), entry), entry);
+            slabs.push_back(move(slab));
+            usedInLastSlab = 0;
+        }
+        slabIndex = slabs.size() - 1;
+        slotIndex = usedInLastSlab++;
+        return &slabs[slabIndex].slots[slotIndex];
+    }
+
+public:
+    NodePool() : freeList(nullptr), usedInLastSlab(0), liveNodes(0) {}
+
+    ~NodePool() {
+        clear();
+    }
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept
+        : slabs(move(other.slabs)), slabsByAddress(move(other.slabsByAddress)), freeList(other.freeList),
+          usedInLastSlab(other.usedInLastSlab), liveNodes(other.liveNodes) {
+        other.slabs.clear();
+        other.slabsByAddress.clear();
+        other.freeList = nullptr;
+        other.usedInLastSlab = 0;
+        other.liveNodes = 0;
+    }
+
+    NodePool& operator=(NodePool&& other) noexcept {
+        if (this != &other) {
+            clear();
+            slabs = move(other.slabs);
+            slabsByAddress = move(other.slabsByAddress);
+            freeList = other.freeList;
+            usedInLastSlab = other.usedInLastSlab;
+            liveNodes = other.liveNodes;
+            other.slabs.clear();
+            other.slabsByAddress.clear();
+            other.freeList = nullptr;
+            other.usedInLastSlab = 0;
+            other.liveNodes = 0;
+        }
+        return *this;
+    }
+
+    template <typename... Args>
+    Node* allocate(Args&&... args) {
+        size_t slabIndex = 0;
+        int slotIndex = 0;
+        Slot* slot = takeSlot(slabIndex, slotIndex);
+        Node* node = new (slot->storage) Node(forward<Args>(args)...);
+        markLive(slabIndex, slotIndex, true);
+        liveNodes++;
+        return node;
+    }
+
+    void release(Node* node) {
+        size_t slabIndex = 0;
+        int slotIndex = 0;
+        if (node == nullptr || !locate(node, slabIndex, slotIndex)) {
+            return;
+        }
+        node->~Node();
+        markLive(slabIndex, slotIndex, false);
+        Slot* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeList;
+        freeList = slot;
+        liveNodes--;
+    }
+
+    // Destroys every live node and returns all slabs to the heap
+    void clear() {
+        for (Slab& slab : slabs) {
+            for (int word = 0; word < NODE_POOL_SLAB_SIZE / 64; word++) {
+                uint64_t live = slab.liveBits[word];
+                while (live != 0) {
+                    int slotIndex = word * 64 + countTrailingZeros64(live);
+                    reinterpret_cast<Node*>(slab.slots[slotIndex].storage)->~Node();
+                    live &= live - 1;
+                }
+            }
+        }
+        slabs.clear();
+        slabs.shrink_to_fit();
+        slabsByAddress.clear();
+        slabsByAddress.shrink_to_fit();
+        freeList = nullptr;
+        usedInLastSlab = 0;
+        liveNodes = 0;
+    }
+
+    // True when the address is a slot of this pool that currently holds a node
+    bool isLive(const Node* node) const {
+        size_t slabIndex = 0;
+        int slotIndex = 0;
+        if (node == nullptr || !locate(node, slabIndex, slotIndex) ||
+            reinterpret_cast<const Slot*>(node) != &slabs[slabIndex].slots[slotIndex]) {
+            return false;
+        }
+        return (slabs[slabIndex].liveBits[slotIndex >> 6] >> (slotIndex & 63)) & 1ULL;
+    }
+
+    size_t size() const {
+        return liveNodes;
+    }
+
+    size_t reservedBytes() const {
+        return slabs.size() * (NODE_POOL_SLAB_SIZE * sizeof(Slot) + sizeof(Slab) + sizeof(pair<const Slot*, size_t>));
+    }
+};
+
+#endif
@@ -0,0 +1,177 @@
+/*
+===============================================================================
+SHARED PARALLEL CSV SCANNER - CHUNKED PARSING, SEQUENTIAL PLACEMENT
+===============================================================================
+Used by: Array Version (loadPassengerDataFromCSV)
+         Linked List Version (readPassengerCSV)
+
+Placing a passenger depends on every row before it (the first plane where
+that seat is still free), so placement has to stay sequential. Parsing does
+not. The mapped file is split into newline-aligned chunks that worker threads
+parse and validate into packed rows. Then the caller's callback runs over the
+rows in file order on the calling thread, exactly as scanPassengerCSV would.
+The result is identical to the sequential scan; only the parsing scales with
+cores.
+
+A packed row keeps the line offset plus field offsets/lengths instead of
+string_views, which is under half the size per row on files with tens of
+millions of lines. Files below PARALLEL_CSV_MIN_BYTES are not worth the thread
+start-up and go through the sequential scanner directly.
+===============================================================================
+*/
+
+#ifndef SHARED_PARALLEL_CSV_SCANNER_H
+#define SHARED_PARALLEL_CSV_SCANNER_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "MappedCSVReader.h"
+
+using namespace std;
+
+const size_t PARALLEL_CSV_MIN_BYTES = 4 * 1024 * 1024;  // Smaller files are scanned sequentially
+const size_t PARALLEL_CSV_CHUNKS_PER_THREAD = 4;        // Extra chunks even out uneven lines
+
+// One parsed row. Offsets are relative to the start of the line, so a row is
+// 24 bytes instead of the 64 of a PassengerCSVRecord with its three string_views.
+struct PackedPassengerRow {
+    uint64_t lineOffset;    // Start of the line in the mapped file
+    int32_t seatRow;        // 1-based, as written in the CSV
+    uint16_t idLength;      // Passenger ID starts at the line itself
+    uint16_t nameOffset;
+    uint16_t nameLength;
+    uint16_t classOffset;
+    uint16_t classLength;
+    char seatColumnLetter;
+};
+
+// Packs a parsed record. Returns false for lines longer than 64 KB, which no
+// passenger row comes close to and which 16-bit offsets cannot address.
+inline bool packPassengerRow(string_view contents, const PassengerCSVRecord& record, PackedPassengerRow& row) {
+    const char* lineStart = record.passengerId.data();
+    size_t nameOffset = static_cast<size_t>(record.passengerName.data() - lineStart);
+    size_t classOffset = static_cast<size_t>(record.passengerClass.data() - lineStart);
+    if (classOffset + record.passengerClass.size() > UINT16_MAX) {
+        return false;
+    }
+
+    row.lineOffset = static_cast<uint64_t>(lineStart - contents.data());
+    row.idLength = static_cast<uint16_t>(record.passengerId.size());
+    row.nameOffset = static_cast<uint16_t>(nameOffset);
+    row.nameLength = static_cast<uint16_t>(record.passengerName.size());
+    row.classOffset = static_cast<uint16_t>(classOffset);
+    row.classLength = static_cast<uint16_t>(record.passengerClass.size());
+    row.seatRow = record.seatRow;
+    row.seatColumnLetter = record.seatColumnLetter;
+    return true;
+}
+
+inline void unpackPassengerRow(string_view contents, const PackedPassengerRow& row, PassengerCSVRecord& record) {
+    const char* lineStart = contents.data() + row.lineOffset;
+    record.passengerId = string_view(lineStart, row.idLength);
+    record.passengerName = string_view(lineStart + row.nameOffset, row.nameLength);
+    record.passengerClass = string_view(lineStart + row.classOffset, row.classLength);
+    record.seatRow = row.seatRow;
+    record.seatColumnLetter = row.seatColumnLetter;
+}
+
+// Parses every complete line in contents[begin, end) into packed rows.
+inline void parsePassengerCSVChunk(string_view contents, size_t begin, size_t end, vector<PackedPassengerRow>& rows) {
+    PassengerCSVRecord record;
+    PackedPassengerRow row;
+    size_t position = begin;
+
+    while (position < end) {
+        size_t lineEnd = contents.find('\n', position);
+        if (lineEnd == string_view::npos || lineEnd > end) {
+            lineEnd = end;
+        }
+
+        string_view line = contents.substr(position, lineEnd - position);
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        position = lineEnd + 1;
+
+        if (!line.empty() && parsePassengerCSVLine(line, record) && packPassengerRow(contents, record, row)) {
+            rows.push_back(row);
+        }
+    }
+}
+
+// Same contract as scanPassengerCSV: onRecord(record) is called for every data
+// row in file order on the calling thread, and returning false stops the scan.
+template <typename RecordCallback>
+int scanPassengerCSVParallel(string_view contents, RecordCallback onRecord) {
+    unsigned int threadCount = thread::hardware_concurrency();
+    if (contents.size() < PARALLEL_CSV_MIN_BYTES || threadCount < 2) {
+        return scanPassengerCSV(contents, onRecord);
+    }
+
+    size_t dataStart = contents.find('\n');
+    if (dataStart == string_view::npos) {
+        return 0; // Header only (or empty file)
+    }
+    dataStart++;
+
+    // Chunk boundaries are moved forward to just after the next newline, so
+    // every line belongs to exactly one chunk
+    size_t chunkCount = threadCount * PARALLEL_CSV_CHUNKS_PER_THREAD;
+    size_t chunkSize = (contents.size() - dataStart) / chunkCount + 1;
+    vector<size_t> chunkStarts;
+    chunkStarts.push_back(dataStart);
+    while (chunkStarts.back() < contents.size()) {
+        size_t boundary = chunkStarts.back() + chunkSize;
+        if (boundary >= contents.size()) {
+            break;
+        }
+        size_t newline = contents.find('\n', boundary);
+        if (newline == string_view::npos) {
+            break;
+        }
+        chunkStarts.push_back(newline + 1);
+    }
+    chunkStarts.push_back(contents.size());
+    chunkCount = chunkStarts.size() - 1;
+
+    // Small pool of workers pulling the next chunk index until none are left
+    vector<vector<PackedPassengerRow>> chunkRows(chunkCount);
+    atomic<size_t> nextChunk(0);
+    auto parseChunks = [&]() {
+        for (size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+            chunkRows[chunk].reserve((chunkStarts[chunk + 1] - chunkStarts[chunk]) / 32);
+            parsePassengerCSVChunk(contents, chunkStarts[chunk], chunkStarts[chunk + 1], chunkRows[chunk]);
+        }
+    };
+
+    vector<thread> workers;
+    size_t workerCount = min(static_cast<size_t>(threadCount), chunkCount);
+    for (size_t i = 1; i < workerCount; i++) {
+        workers.emplace_back(parseChunks);
+    }
+    parseChunks(); // The calling thread parses too
+    for (thread& worker : workers) {
+        worker.join();
+    }
+
+    // Sequential pass over the packed rows, in file order
+    int recordsScanned = 0;
+    PassengerCSVRecord record;
+    for (const vector<PackedPassengerRow>& rows : chunkRows) {
+        for (const PackedPassengerRow& row : rows) {
+            unpackPassengerRow(contents, row, record);
+            recordsScanned++;
+            if (!onRecord(record)) {
+                return recordsScanned;
+            }
+        }
+    }
+    return recordsScanned;
+}
+
+#endif
@@ -0,0 +1,210 @@
+/*
+===============================================================================
+SHARED PASSENGER DICTIONARY - COMPACT PASSENGER FIELDS
+===============================================================================
+Used by: Array Version (Passenger records in every Plane)
+
+A passenger record used to carry three std::strings (ID, name, class), about
+100 bytes before any heap allocation. The fields are encoded instead:
+
+  - ID     : uint32_t, parsed from the canonical decimal ID ("100037")
+  - class  : PassengerClassCode, one byte (same values as SEAT_CLASS_*)
+  - name   : PassengerNameRef, four bytes
+
+Names come from a small first-name x last-name vocabulary ("Carol Williams"),
+so a name is split at its first space and stored as (firstNameId, lastNameId)
+into two shared dictionaries. Names that do not split (no space, an empty
+part, or a full dictionary) are outliers: their text is appended to a string
+arena and the reference holds the arena entry instead.
+
+Dictionary words and arena entries are never removed, so a reference stays
+valid for as long as the dictionary exists; clear() drops everything when the
+data is reloaded.
+===============================================================================
+*/
+
+#ifndef SHARED_PASSENGER_DICTIONARY_H
+#define SHARED_PASSENGER_DICTIONARY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "SeatBitmap.h"
+
+using namespace std;
+
+enum class PassengerClassCode : uint8_t {
+    First = SEAT_CLASS_FIRST,
+    Business = SEAT_CLASS_BUSINESS,
+    Economy = SEAT_CLASS_ECONOMY
+};
+
+// "First"/"Business"/anything else (Economy is the default, as in seatClassIndex)
+inline PassengerClassCode passengerClassCodeOf(const string& passengerClass) {
+    return static_cast<PassengerClassCode>(seatClassIndex(passengerClass));
+}
+
+inline const string& passengerClassName(PassengerClassCode classCode) {
+    static const string names[SEAT_CLASS_COUNT] = {"First", "Business", "Economy"};
+    return names[static_cast<int>(classCode)];
+}
+
+// Numeric value of a canonical decimal ID that fits in 32 bits. Returns false otherwise.
+inline bool parsePassengerId32(const string& passengerId, uint32_t& value) {
+    if (passengerId.empty() || passengerId.size() > 10 || (passengerId[0] == '0' && passengerId.size() > 1)) {
+        return false;
+    }
+    uint64_t parsed = 0;
+    for (char c : passengerId) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        parsed = parsed * 10 + static_cast<uint64_t>(c - '0');
+    }
+    if (parsed > UINT32_MAX) {
+        return false;
+    }
+    value = static_cast<uint32_t>(parsed);
+    return true;
+}
+
+const uint32_t PASSENGER_NAME_ARENA_BIT = 0x80000000u;
+const uint32_t PASSENGER_FIRST_NAME_LIMIT = 0x8000u;  // First-name IDs use 15 bits
+const uint32_t PASSENGER_LAST_NAME_LIMIT = 0x10000u;  // Last-name IDs use 16 bits
+
+// Either (firstNameId, lastNameId) or, with the top bit set, an arena entry
+struct PassengerNameRef {
+    uint32_t code;
+
+    PassengerNameRef() : code(0) {}
+
+    bool isOutlier() const {
+        return (code & PASSENGER_NAME_ARENA_BIT) != 0;
+    }
+
+    uint32_t firstNameId() const {
+        return code >> 16;
+    }
+
+    uint32_t lastNameId() const {
+        return code & 0xFFFFu;
+    }
+
+    uint32_t arenaEntry() const {
+        return code & ~PASSENGER_NAME_ARENA_BIT;
+    }
+};
+
+class PassengerNameDictionary {
+private:
+    vector<string> firstNames;
+    vector<string> lastNames;
+    unordered_map<string, uint32_t> firstNameIds;
+    unordered_map<string, uint32_t> lastNameIds;
+
+    // Outlier names back to back; entry i is [arenaOffsets[i], arenaOffsets[i + 1])
+    string arena;
+    vector<uint32_t> arenaOffsets;
+
+    static bool internWord(const string& word, vector<string>& words, unordered_map<string, uint32_t>& ids,
+                           uint32_t limit, uint32_t& id) {
+        auto found = ids.find(word);
+        if (found != ids.end()) {
+            id = found->second;
+            return true;
+        }
+        if (words.size() >= limit) {
+            return false;
+        }
+        id = static_cast<uint32_t>(words.size());
+        words.push_back(word);
+        ids.emplace(word, id);
+        return true;
+    }
+
+    static size_t stringBytes(const string& text) {
+        // Heap block only once the text outgrows the small-string buffer
+        return sizeof(string) + (text.capacity() > 15 ? text.capacity() + 1 : 0);
+    }
+
+    static size_t wordTableBytes(const vector<string>& words, const unordered_map<string, uint32_t>& ids) {
+        size_t bytes = words.capacity() * sizeof(string) + ids.bucket_count() * sizeof(void*);
+        for (const string& word : words) {
+            // The word itself, its copy as a map key, and the map node around that key
+            bytes += 2 * stringBytes(word) - sizeof(string) + sizeof(pair<const string, uint32_t>) + sizeof(void*);
+        }
+        return bytes;
+    }
+
+public:
+    PassengerNameDictionary() : arenaOffsets(1, 0) {}
+
+    void clear() {
+        firstNames.clear();
+        lastNames.clear();
+        firstNameIds.clear();
+        lastNameIds.clear();
+        arena.clear();
+        arena.shrink_to_fit();
+        arenaOffsets.assign(1, 0);
+    }
+
+    PassengerNameRef encode(const string& passengerName) {
+        PassengerNameRef ref;
+        size_t space = passengerName.find(' ');
+        if (space != string::npos && space > 0 && space + 1 < passengerName.size()) {
+            uint32_t firstId;
+            uint32_t lastId;
+            // A full last-name table leaves the first name interned but unused, which is
+            // harmless: the dictionaries only ever grow
+            if (internWord(passengerName.substr(0, space), firstNames, firstNameIds, PASSENGER_FIRST_NAME_LIMIT, firstId) &&
+                internWord(passengerName.substr(space + 1), lastNames, lastNameIds, PASSENGER_LAST_NAME_LIMIT, lastId)) {
+                ref.code = (firstId << 16) | lastId;
+                return ref;
+            }
+        }
+
+        ref.code = PASSENGER_NAME_ARENA_BIT | static_cast<uint32_t>(arenaOffsets.size() - 1);
+        arena.append(passengerName);
+        arenaOffsets.push_back(static_cast<uint32_t>(arena.size()));
+        return ref;
+    }
+
+    string decode(PassengerNameRef ref) const {
+        if (ref.isOutlier()) {
+            uint32_t entry = ref.arenaEntry();
+            return arena.substr(arenaOffsets[entry], arenaOffsets[entry + 1] - arenaOffsets[entry]);
+        }
+        const string& firstName = firstNames[ref.firstNameId()];
+        const string& lastName = lastNames[ref.lastNameId()];
+        string passengerName;
+        passengerName.reserve(firstName.size() + 1 + lastName.size());
+        passengerName.append(firstName).append(1, ' ').append(lastName);
+        return passengerName;
+    }
+
+    int getFirstNameCount() const {
+        return static_cast<int>(firstNames.size());
+    }
+
+    int getLastNameCount() const {
+        return static_cast<int>(lastNames.size());
+    }
+
+    int getOutlierCount() const {
+        return static_cast<int>(arenaOffsets.size() - 1);
+    }
+
+    // Approximate heap and table bytes held by the dictionaries and the arena
+    size_t bytesUsed() const {
+        return sizeof(PassengerNameDictionary) +
+               wordTableBytes(firstNames, firstNameIds) +
+               wordTableBytes(lastNames, lastNameIds) +
+               arena.capacity() + arenaOffsets.capacity() * sizeof(uint32_t);
+    }
+};
+
+#endif
@@ -0,0 +1,275 @@
+/*
+===============================================================================
+SHARED PASSENGER ID SKIP LIST - ORDERED INDEX BY NUMERIC PASSENGER ID
+===============================================================================
+Used by: Linked List Version (searchPassenger, removePassengerById, ID ranges)
+         Main.cpp passenger ID range report
+
+A skip list over the records a backend already owns: every entry is a tower
+holding the numeric ID and a pointer to the record, so nothing is copied and
+the records stay where they are. Level i links about one entry in 4^i, which
+gives expected O(log n) for:
+  - find(key)               : first entry with that ID
+  - insert(key, record)     : equal IDs keep their insertion order
+  - erase(key, record)      : unlinks that record's tower
+  - forEachInRange(lo, hi)  : every entry with lo <= ID <= hi, in ID order
+
+Only canonical decimal IDs ("100037", not "0100037" or "P-17") get a key, so
+different ID strings never share one. Records with other IDs are simply not
+indexed and the caller falls back to scanning for them.
+===============================================================================
+*/
+
+#ifndef SHARED_PASSENGER_ID_SKIP_LIST_H
+#define SHARED_PASSENGER_ID_SKIP_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+
+using namespace std;
+
+const int SKIP_LIST_MAX_LEVEL = 16;        // 4^16 entries before the top level saturates
+const int SKIP_LIST_MAX_KEY_DIGITS = 18;   // Every 18-digit number fits in uint64_t
+
+// Numeric key of a canonical decimal ID. Returns false for anything else.
+inline bool parsePassengerIdKey(const string& passengerId, uint64_t& key) {
+    if (passengerId.empty() || passengerId.size() > static_cast<size_t>(SKIP_LIST_MAX_KEY_DIGITS) ||
+        (passengerId[0] == '0' && passengerId.size() > 1)) {
+        return false;
+    }
+    key = 0;
+    for (char c : passengerId) {
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        key = key * 10 + static_cast<uint64_t>(c - '0');
+    }
+    return true;
+}
+
+template <typename Record>
+class PassengerIdSkipList {
+private:
+    struct Tower {
+        uint64_t key;
+        Record* record;
+        int levels;
+        Tower* forward[1]; // Really `levels` entries, allocated past the end of the struct
+    };
+
+    Tower* head;       // Sentinel with SKIP_LIST_MAX_LEVEL levels and no record (allocated on first insert)
+    int currentLevel;  // Levels in use (at least 1)
+    size_t entryCount;
+    uint32_t randomState;
+
+    static Tower* allocateTower(int levels, uint64_t key, Record* record) {
+        size_t bytes = sizeof(Tower) + static_cast<size_t>(levels - 1) * sizeof(Tower*);
+        Tower* tower = static_cast<Tower*>(::operator new(bytes));
+        tower->key = key;
+        tower->record = record;
+        tower->levels = levels;
+        for (int level = 0; level < levels; level++) {
+            tower->forward[level] = nullptr;
+        }
+        return tower;
+    }
+
+    static void freeTower(Tower* tower) {
+        ::operator delete(tower);
+    }
+
+    // Each extra level with probability 1/4 (xorshift32, fixed seed, so runs repeat)
+    int randomLevel() {
+        randomState ^= randomState << 13;
+        randomState ^= randomState >> 17;
+        randomState ^= randomState << 5;
+        uint32_t bits = randomState;
+        int levels = 1;
+        while (levels < SKIP_LIST_MAX_LEVEL && (bits & 3) == 0) {
+            levels++;
+            bits >>= 2;
+        }
+        return levels;
+    }
+
+    // Last tower on each level whose key is below `key`
+    Tower* findPredecessors(uint64_t key, Tower* predecessors[]) const {
+        Tower* current = head;
+        for (int level = currentLevel - 1; level >= 0; level--) {
+            while (current->forward[level] != nullptr && current->forward[level]->key < key) {
+                current = current->forward[level];
+            }
+            predecessors[level] = current;
+        }
+        return current->forward[0];
+    }
+
+    void releaseEntries() {
+        if (head == nullptr) {
+            return;
+        }
+        Tower* current = head->forward[0];
+        while (current != nullptr) {
+            Tower* following = current->forward[0];
+            freeTower(current);
+            current = following;
+        }
+        for (int level = 0; level < SKIP_LIST_MAX_LEVEL; level++) {
+            head->forward[level] = nullptr;
+        }
+        currentLevel = 1;
+        entryCount = 0;
+    }
+
+public:
+    PassengerIdSkipList() : head(nullptr), currentLevel(1), entryCount(0), randomState(2463534242u) {}
+
+    ~PassengerIdSkipList() {
+        if (head != nullptr) {
+            releaseEntries();
+            freeTower(head);
+        }
+    }
+
+    PassengerIdSkipList(const PassengerIdSkipList&) = delete;
+    PassengerIdSkipList& operator=(const PassengerIdSkipList&) = delete;
+
+    PassengerIdSkipList(PassengerIdSkipList&& other) noexcept
+        : head(other.head), currentLevel(other.currentLevel), entryCount(other.entryCount), randomState(other.randomState) {
+        other.head = nullptr;
+        other.currentLevel = 1;
+        other.entryCount = 0;
+    }
+
+    PassengerIdSkipList& operator=(PassengerIdSkipList&& other) noexcept {
+        if (this != &other) {
+            swap(head, other.head);
+            swap(currentLevel, other.currentLevel);
+            swap(entryCount, other.entryCount);
+            swap(randomState, other.randomState);
+            other.clear();
+        }
+        return *this;
+    }
+
+    void clear() {
+        releaseEntries();
+    }
+
+    size_t size() const {
+        return entryCount;
+    }
+
+    // Adds the record after every entry with the same key
+    void insert(uint64_t key, Record* record) {
+        if (head == nullptr) {
+            head = allocateTower(SKIP_LIST_MAX_LEVEL, 0, nullptr);
+        }
+        Tower* predecessors[SKIP_LIST_MAX_LEVEL];
+        Tower* current = head;
+        for (int level = currentLevel - 1; level >= 0; level--) {
+            while (current->forward[level] != nullptr && current->forward[level]->key <= key) {
+                current = current->forward[level];
+            }
+            predecessors[level] = current;
+        }
+
+        int levels = randomLevel();
+        for (int level = currentLevel; level < levels; level++) {
+            predecessors[level] = head;
+        }
+        if (levels > currentLevel) {
+            currentLevel = levels;
+        }
+
+        Tower* tower = allocateTower(levels, key, record);
+        for (int level = 0; level < levels; level++) {
+            tower->forward[level] = predecessors[level]->forward[level];
+            predecessors[level]->forward[level] = tower;
+        }
+        entryCount++;
+    }
+
+    // First record with this key (in insertion order) for which matches(record) holds
+    template <typename Matcher>
+    Record* find(uint64_t key, Matcher matches) const {
+        if (head == nullptr) {
+            return nullptr;
+        }
+        Tower* predecessors[SKIP_LIST_MAX_LEVEL];
+        for (Tower* current = findPredecessors(key, predecessors); current != nullptr && current->key == key;
+             current = current->forward[0]) {
+            if (matches(current->record)) {
+                return current->record;
+            }
+        }
+        return nullptr;
+    }
+
+    // Unlinks the entry of this exact record. Returns false when it is not indexed.
+    bool erase(uint64_t key, const Record* record) {
+        if (head == nullptr) {
+            return false;
+        }
+        Tower* predecessors[SKIP_LIST_MAX_LEVEL];
+        Tower* target = findPredecessors(key, predecessors);
+        while (target != nullptr && target->key == key && target->record != record) {
+            target = target->forward[0];
+        }
+        if (target == nullptr || target->key != key) {
+            return false;
+        }
+
+        // Equal keys are rare, so stepping past them to the target stays cheap
+        for (int level = 0; level < target->levels; level++) {
+            Tower* predecessor = predecessors[level];
+            while (predecessor->forward[level] != target) {
+                predecessor = predecessor->forward[level];
+            }
+            predecessor->forward[level] = target->forward[level];
+        }
+        freeTower(target);
+        entryCount--;
+
+        while (currentLevel > 1 && head->forward[currentLevel - 1] == nullptr) {
+            currentLevel--;
+        }
+        return true;
+    }
+
+    // Calls visit(record) for every entry with firstKey <= key <= lastKey, in key order
+    template <typename Visitor>
+    void forEachInRange(uint64_t firstKey, uint64_t lastKey, Visitor visit) const {
+        if (head == nullptr) {
+            return;
+        }
+        Tower* predecessors[SKIP_LIST_MAX_LEVEL];
+        for (Tower* current = findPredecessors(firstKey, predecessors); current != nullptr && current->key <= lastKey;
+             current = current->forward[0]) {
+            visit(current->record);
+        }
+    }
+
+    // Largest key in the index, found by walking down the right edge
+    bool maxKey(uint64_t& key) const {
+        if (head == nullptr) {
+            return false;
+        }
+        Tower* current = head;
+        for (int level = currentLevel - 1; level >= 0; level--) {
+            while (current->forward[level] != nullptr) {
+                current = current->forward[level];
+            }
+        }
+        if (current == head) {
+            return false;
+        }
+        key = current->key;
+        return true;
+    }
+};
+
+#endif
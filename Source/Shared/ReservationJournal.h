@@ -0,0 +1,262 @@
+/*
+===============================================================================
+SHARED RESERVATION JOURNAL - APPEND-ONLY LOG OF BOOKINGS AND CANCELLATIONS
+===============================================================================
+Used by: Array Version (insertReservation, cancelReservation)
+         Linked List Version (insertPassengerReservation, deletePassengerReservation)
+
+Rewriting the whole CSV for every booking costs the size of the file. Instead
+each change is appended to a small journal next to the CSV ("X.csv" ->
+"X.journal"), and the CSV is only rewritten once the journal has grown past
+JOURNAL_COMPACTION_RECORDS entries (compaction).
+
+  Header      : JOURNAL,<version>,<csv size>,<csv modification time>
+  Reservation : R,<plane number>,<PassengerID>,<Name>,<SeatRow>,<SeatColumn>,<Class>
+  Cancellation: C,<PassengerID>
+
+Group commit: appended records are buffered and written with a single write
+and flush when commit() is called (once per user operation) or when
+JOURNAL_GROUP_COMMIT_RECORDS records are waiting, whichever comes first.
+
+The header stamps the CSV the journal applies to. Rewriting the CSV makes the
+old journal stale, so a journal whose stamp no longer matches is ignored and
+restarted; this also covers a crash between rewriting the CSV and restarting
+the journal. A torn last line (no trailing newline) is ignored on replay.
+===============================================================================
+*/
+
+#ifndef SHARED_RESERVATION_JOURNAL_H
+#define SHARED_RESERVATION_JOURNAL_H
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <charconv>
+
+#include "MappedCSVReader.h"
+#include "FleetSnapshot.h"
+
+#ifdef _WIN32
+#include <io.h>
+#endif
+
+using namespace std;
+
+const int JOURNAL_FORMAT_VERSION = 1;
+const int JOURNAL_GROUP_COMMIT_RECORDS = 64;  // Pending records that force a write
+const int JOURNAL_COMPACTION_RECORDS = 512;   // Journal records before the CSV is rewritten
+
+const char JOURNAL_RESERVATION = 'R';
+const char JOURNAL_CANCELLATION = 'C';
+
+// One replayed journal line. For a cancellation only passengerId is set.
+struct ReservationJournalEntry {
+    char operation;
+    int planeNumber;            // 1-based
+    PassengerCSVRecord passenger;
+};
+
+// "...\FlightPassengerDataArray.csv" -> "...\FlightPassengerDataArray.journal"
+inline string reservationJournalPathFor(const string& csvPath) {
+    return replaceFileExtension(csvPath, ".journal");
+}
+
+inline string journalHeaderLine(uint64_t sourceSize, int64_t sourceModified) {
+    return "JOURNAL," + to_string(JOURNAL_FORMAT_VERSION) + "," + to_string(sourceSize) + "," +
+           to_string(sourceModified) + "\n";
+}
+
+// Splits one journal line into an entry. Returns false for anything malformed.
+inline bool parseReservationJournalLine(string_view line, ReservationJournalEntry& entry) {
+    if (line.size() < 3 || line[1] != ',') {
+        return false;
+    }
+    entry.operation = line[0];
+    string_view payload = line.substr(2);
+
+    if (entry.operation == JOURNAL_CANCELLATION) {
+        entry.planeNumber = -1;
+        entry.passenger = PassengerCSVRecord();
+        entry.passenger.passengerId = payload;
+        return true;
+    }
+    if (entry.operation != JOURNAL_RESERVATION) {
+        return false;
+    }
+
+    size_t comma = payload.find(',');
+    if (comma == string_view::npos) {
+        return false;
+    }
+    auto parsed = from_chars(payload.data(), payload.data() + comma, entry.planeNumber);
+    if (parsed.ec != errc() || entry.planeNumber < 1) {
+        return false;
+    }
+    // The rest of the line has exactly the CSV row layout
+    return parsePassengerCSVLine(payload.substr(comma + 1), entry.passenger);
+}
+
+// Calls onEntry(entry) for every complete entry of a journal that still applies
+// to sourcePath. Returns the number of entries replayed (0 for a stale journal).
+template <typename EntryCallback>
+int replayReservationJournal(const string& journalPath, const string& sourcePath, EntryCallback onEntry) {
+    MappedFile journalFile;
+    uint64_t sourceSize = 0;
+    int64_t sourceModified = 0;
+    if (!readFileStamp(sourcePath, sourceSize, sourceModified) || !journalFile.open(journalPath)) {
+        return 0;
+    }
+
+    string_view contents = journalFile.contents();
+    string header = journalHeaderLine(sourceSize, sourceModified);
+    if (contents.substr(0, header.size()) != header) {
+        return 0; // Written against an older CSV, already folded into it
+    }
+
+    int entriesReplayed = 0;
+    ReservationJournalEntry entry;
+    size_t position = header.size();
+    while (position < contents.size()) {
+        size_t lineEnd = contents.find('\n', position);
+        if (lineEnd == string_view::npos) {
+            break; // Torn final write
+        }
+        string_view line = contents.substr(position, lineEnd - position);
+        position = lineEnd + 1;
+
+        if (parseReservationJournalLine(line, entry)) {
+            onEntry(entry);
+            entriesReplayed++;
+        }
+    }
+    return entriesReplayed;
+}
+
+class ReservationJournal {
+private:
+    FILE* journalFile;
+    string journalPath;
+    string sourcePath;
+    string pendingBytes;
+    int pendingRecords;
+    int recordsSinceCompaction;
+
+    void appendPending(const string& line) {
+        pendingBytes.append(line);
+        pendingRecords++;
+        recordsSinceCompaction++;
+        if (pendingRecords >= JOURNAL_GROUP_COMMIT_RECORDS) {
+            commit();
+        }
+    }
+
+public:
+    ReservationJournal() : journalFile(nullptr), pendingRecords(0), recordsSinceCompaction(0) {}
+
+    ~ReservationJournal() {
+        close();
+    }
+
+    ReservationJournal(const ReservationJournal&) = delete;
+    ReservationJournal& operator=(const ReservationJournal&) = delete;
+
+    bool isOpen() const {
+        return journalFile != nullptr;
+    }
+
+    // Truncates the journal to an empty one stamped with the current source file.
+    bool start(const string& newJournalPath, const string& newSourcePath) {
+        close();
+        uint64_t sourceSize = 0;
+        int64_t sourceModified = 0;
+        if (!readFileStamp(newSourcePath, sourceSize, sourceModified)) {
+            return false;
+        }
+        journalFile = fopen(newJournalPath.c_str(), "wb");
+        if (journalFile == nullptr) {
+            return false;
+        }
+        journalPath = newJournalPath;
+        sourcePath = newSourcePath;
+        recordsSinceCompaction = 0;
+        pendingBytes = journalHeaderLine(sourceSize, sourceModified);
+        return commit();
+    }
+
+    // Keeps appending to a journal that still applies to the source file
+    // (replayedRecords of them are already in it), or starts a fresh one.
+    bool resume(const string& newJournalPath, const string& newSourcePath, int replayedRecords) {
+        if (replayedRecords <= 0) {
+            return start(newJournalPath, newSourcePath);
+        }
+        close();
+        journalFile = fopen(newJournalPath.c_str(), "ab");
+        if (journalFile == nullptr) {
+            return false;
+        }
+        journalPath = newJournalPath;
+        sourcePath = newSourcePath;
+        recordsSinceCompaction = replayedRecords;
+
+        // Terminate a torn last line so it cannot merge with the next record
+        MappedFile existing;
+        if (existing.open(newJournalPath)) {
+            string_view contents = existing.contents();
+            if (!contents.empty() && contents.back() != '\n') {
+                pendingBytes.push_back('\n');
+            }
+        }
+        return commit();
+    }
+
+    void appendReservation(const string& passengerId, const string& passengerName, const string& passengerClass,
+                           int planeNumber, int seatRow, int seatColumn) {
+        if (!isOpen()) {
+            return;
+        }
+        appendPending(string(1, JOURNAL_RESERVATION) + "," + to_string(planeNumber) + "," + passengerId + "," +
+                      passengerName + "," + to_string(seatRow + 1) + "," + static_cast<char>('A' + seatColumn) + "," +
+                      passengerClass + "\n");
+    }
+
+    void appendCancellation(const string& passengerId) {
+        if (!isOpen()) {
+            return;
+        }
+        appendPending(string(1, JOURNAL_CANCELLATION) + "," + passengerId + "\n");
+    }
+
+    // Writes every pending record with one write, then flushes it to disk.
+    bool commit() {
+        if (!isOpen() || pendingBytes.empty()) {
+            return true;
+        }
+        bool written = fwrite(pendingBytes.data(), 1, pendingBytes.size(), journalFile) == pendingBytes.size();
+        written = (fflush(journalFile) == 0) && written;
+#ifdef _WIN32
+        _commit(_fileno(journalFile));
+#else
+        fsync(fileno(journalFile));
+#endif
+        pendingBytes.clear();
+        pendingRecords = 0;
+        return written;
+    }
+
+    bool isCompactionDue() const {
+        return recordsSinceCompaction >= JOURNAL_COMPACTION_RECORDS;
+    }
+
+    void close() {
+        if (journalFile != nullptr) {
+            commit();
+            fclose(journalFile);
+            journalFile = nullptr;
+        }
+        pendingBytes.clear();
+        pendingRecords = 0;
+    }
+};
+
+#endif
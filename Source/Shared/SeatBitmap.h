@@ -0,0 +1,147 @@
+/*
+===============================================================================
+SHARED SEAT BITMAP - 180-BIT OCCUPANCY MAP FOR ONE PLANE
+===============================================================================
+Every plane has 30 rows x 6 columns = 180 seats. Seat (row, column) is stored
+as bit (row * 6 + column) across three 64-bit words, 1 = occupied.
+
+Each cabin class covers a contiguous run of rows, so it is also a contiguous
+run of bits. With the precomputed class masks, "first free seat in a class"
+is a count-trailing-zeros and "free seats in a class" is a popcount.
+  First    : rows 1-3   -> bits 0-17
+  Business : rows 4-10  -> bits 18-59
+  Economy  : rows 11-30 -> bits 60-179
+===============================================================================
+*/
+
+#ifndef SHARED_SEAT_BITMAP_H
+#define SHARED_SEAT_BITMAP_H
+
+#include <cstdint>
+#include <string>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+
+const int SEAT_BITMAP_ROWS = 30;
+const int SEAT_BITMAP_COLUMNS = 6;
+const int SEAT_BITMAP_SEATS = SEAT_BITMAP_ROWS * SEAT_BITMAP_COLUMNS;
+const int SEAT_BITMAP_WORDS = 3;
+
+// Converts a zero-based (row, column) pair to its bit position, or -1 if it is off the grid.
+inline int seatSlotIndex(int seatRow, int seatColumn) {
+    if (seatRow < 0 || seatRow >= SEAT_BITMAP_ROWS || seatColumn < 0 || seatColumn >= SEAT_BITMAP_COLUMNS) {
+        return -1;
+    }
+    return seatRow * SEAT_BITMAP_COLUMNS + seatColumn;
+}
+
+// Class indexes used for the row masks below
+const int SEAT_CLASS_FIRST = 0;
+const int SEAT_CLASS_BUSINESS = 1;
+const int SEAT_CLASS_ECONOMY = 2;
+const int SEAT_CLASS_ANY = 3; // Whole plane
+const int SEAT_CLASS_COUNT = 3;
+
+// Bits 0-17 | 18-59 | 60-179 | 0-179, split over the three words
+const uint64_t SEAT_CLASS_MASKS[4][SEAT_BITMAP_WORDS] = {
+    {0x000000000003FFFFULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0FFFFFFFFFFC0000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0xF000000000000000ULL, 0xFFFFFFFFFFFFFFFFULL, 0x000FFFFFFFFFFFFFULL},
+    {0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL, 0x000FFFFFFFFFFFFFULL},
+};
+
+// Seats per class: 3 rows, 7 rows and 20 rows of 6 seats
+const int SEAT_CLASS_CAPACITY[SEAT_CLASS_COUNT] = {18, 42, 120};
+
+// Class index of a zero-based seat row
+inline int seatClassOfRow(int seatRow) {
+    if (seatRow <= 2) {
+        return SEAT_CLASS_FIRST;
+    }
+    if (seatRow <= 9) {
+        return SEAT_CLASS_BUSINESS;
+    }
+    return SEAT_CLASS_ECONOMY;
+}
+
+// Maps "First"/"Business"/anything else to its class index (Economy is the default, as elsewhere)
+inline int seatClassIndex(const string& passengerClass) {
+    if (passengerClass == "First") {
+        return SEAT_CLASS_FIRST;
+    }
+    if (passengerClass == "Business") {
+        return SEAT_CLASS_BUSINESS;
+    }
+    return SEAT_CLASS_ECONOMY;
+}
+
+inline int countTrailingZeros64(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+inline int popCount64(uint64_t value) {
+#ifdef _MSC_VER
+    return static_cast<int>(__popcnt64(value));
+#else
+    return __builtin_popcountll(value);
+#endif
+}
+
+struct SeatBitmap {
+    uint64_t words[SEAT_BITMAP_WORDS];
+
+    SeatBitmap() : words{0, 0, 0} {}
+
+    bool test(int slot) const {
+        return (words[slot >> 6] >> (slot & 63)) & 1ULL;
+    }
+
+    void set(int slot) {
+        words[slot >> 6] |= (1ULL << (slot & 63));
+    }
+
+    void clear(int slot) {
+        words[slot >> 6] &= ~(1ULL << (slot & 63));
+    }
+
+    void reset() {
+        words[0] = 0;
+        words[1] = 0;
+        words[2] = 0;
+    }
+
+    // Lowest free seat slot inside the class (row-major order), or -1 if the class is full.
+    int findFirstFree(int seatClass) const {
+        for (int w = 0; w < SEAT_BITMAP_WORDS; w++) {
+            uint64_t freeBits = ~words[w] & SEAT_CLASS_MASKS[seatClass][w];
+            if (freeBits != 0) {
+                return (w << 6) + countTrailingZeros64(freeBits);
+            }
+        }
+        return -1;
+    }
+
+    int countFree(int seatClass) const {
+        int total = 0;
+        for (int w = 0; w < SEAT_BITMAP_WORDS; w++) {
+            total += popCount64(~words[w] & SEAT_CLASS_MASKS[seatClass][w]);
+        }
+        return total;
+    }
+
+    int countOccupied() const {
+        return popCount64(words[0]) + popCount64(words[1]) + popCount64(words[2]);
+    }
+};
+
+#endif
@@ -0,0 +1,125 @@
+/*
+===============================================================================
+SHARED SEAT POSITION INDEX - WHICH PLANES HAVE SEAT 12C FREE
+===============================================================================
+Used by: Array Version (CSV exact-seat placement, preferred-seat booking)
+         Linked List Version (CSV placement, preferred-seat booking)
+         Main.cpp seat position query
+
+The inverse of the per-plane seat bitmap: for each of the 180 seat positions
+there is one bitset over the fleet, bit p = that seat is occupied on plane
+position p. "First plane where 12C is free" is a scan for the first zero bit
+and "every plane where 1A is taken" is a walk over the set bits, both one
+64-plane word at a time.
+===============================================================================
+*/
+
+#ifndef SHARED_SEAT_POSITION_INDEX_H
+#define SHARED_SEAT_POSITION_INDEX_H
+
+#include <cstdint>
+#include <vector>
+
+#include "SeatBitmap.h"
+
+using namespace std;
+
+class SeatPositionIndex {
+private:
+    int planeCount;
+    vector<uint64_t> occupiedPlanes[SEAT_BITMAP_SEATS];
+
+public:
+    SeatPositionIndex() : planeCount(0) {}
+
+    void clear() {
+        planeCount = 0;
+        for (int slot = 0; slot < SEAT_BITMAP_SEATS; slot++) {
+            occupiedPlanes[slot].clear();
+        }
+    }
+
+    int size() const {
+        return planeCount;
+    }
+
+    // Starts tracking planes up to position count - 1 (new planes have every seat free)
+    void ensurePlanes(int count) {
+        if (count <= planeCount) {
+            return;
+        }
+        size_t wordsNeeded = static_cast<size_t>((count + 63) / 64);
+        if (wordsNeeded > occupiedPlanes[0].size()) {
+            for (int slot = 0; slot < SEAT_BITMAP_SEATS; slot++) {
+                occupiedPlanes[slot].resize(wordsNeeded, 0);
+            }
+        }
+        planeCount = count;
+    }
+
+    void setOccupied(int planePosition, int slot, bool occupied) {
+        if (slot < 0 || slot >= SEAT_BITMAP_SEATS || planePosition < 0) {
+            return;
+        }
+        ensurePlanes(planePosition + 1);
+        uint64_t bit = 1ULL << (planePosition & 63);
+        if (occupied) {
+            occupiedPlanes[slot][planePosition >> 6] |= bit;
+        } else {
+            occupiedPlanes[slot][planePosition >> 6] &= ~bit;
+        }
+    }
+
+    bool isOccupied(int planePosition, int slot) const {
+        if (slot < 0 || slot >= SEAT_BITMAP_SEATS || planePosition < 0 || planePosition >= planeCount) {
+            return false;
+        }
+        return (occupiedPlanes[slot][planePosition >> 6] >> (planePosition & 63)) & 1ULL;
+    }
+
+    // Lowest tracked plane position where this seat is free, or -1 if it is taken everywhere
+    int findFirstPlaneWithSeatFree(int slot) const {
+        if (slot < 0 || slot >= SEAT_BITMAP_SEATS) {
+            return -1;
+        }
+        const vector<uint64_t>& bits = occupiedPlanes[slot];
+        for (size_t w = 0; w < bits.size(); w++) {
+            uint64_t freeBits = ~bits[w];
+            if (freeBits != 0) {
+                int planePosition = static_cast<int>(w * 64) + countTrailingZeros64(freeBits);
+                return planePosition < planeCount ? planePosition : -1;
+            }
+        }
+        return -1;
+    }
+
+    // Every plane position where this seat is occupied, lowest first
+    vector<int> collectPlanesWithSeatOccupied(int slot) const {
+        vector<int> planePositions;
+        if (slot < 0 || slot >= SEAT_BITMAP_SEATS) {
+            return planePositions;
+        }
+        const vector<uint64_t>& bits = occupiedPlanes[slot];
+        for (size_t w = 0; w < bits.size(); w++) {
+            uint64_t word = bits[w];
+            while (word != 0) {
+                planePositions.push_back(static_cast<int>(w * 64) + countTrailingZeros64(word));
+                word &= word - 1;
+            }
+        }
+        return planePositions;
+    }
+
+    int countPlanesWithSeatOccupied(int slot) const {
+        if (slot < 0 || slot >= SEAT_BITMAP_SEATS) {
+            return 0;
+        }
+        int total = 0;
+        for (uint64_t word : occupiedPlanes[slot]) {
+            total += popCount64(word);
+        }
+        return total;
+    }
+};
+
+#endif
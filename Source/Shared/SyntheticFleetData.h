@@ -0,0 +1,220 @@
+/*
+===============================================================================
+SHARED SYNTHETIC FLEET DATA - SEEDED PASSENGER CSV GENERATOR
+===============================================================================
+Used by: Dataset generator (Benchmark/GenerateFleetData.cpp)
+         Benchmark scaling mode (Benchmark/BenchmarkMain.cpp)
+
+Writes manifests in the same schema as the shipped data files:
+
+  PassengerID,Name,SeatRow,SeatColumn,Class
+  100000,Carol Williams,29,B,Economy
+
+so both loaders and the seat placement can be measured far past 10,000 rows.
+Every row is valid: names come from the shipped data's first- and last-name
+vocabulary, the seat row lies inside the class's rows, and IDs count up from
+firstPassengerId. Three knobs shape the load:
+
+  - classMix           : share of First / Business / Economy rows
+                         (default = the seat shares, 18 / 42 / 120 of 180)
+  - seatCollisionRate  : share of rows whose seat is already taken on the
+                         plane being filled, so the loader has to search on
+  - duplicateIdRate    : share of rows repeating an earlier ID (loaders skip them)
+
+With no collisions the rows of each class fill planes exactly: every class
+hands out a shuffled permutation of its seats, then starts a new plane. A
+colliding row instead repeats a seat already handed out on that plane.
+
+The generator uses its own arithmetic on mt19937_64 rather than the standard
+distributions, so a seed produces the same file with every compiler.
+===============================================================================
+*/
+
+#ifndef SHARED_SYNTHETIC_FLEET_DATA_H
+#define SHARED_SYNTHETIC_FLEET_DATA_H
+
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "SeatBitmap.h"
+
+using namespace std;
+
+const char* const SYNTHETIC_FIRST_NAMES[] = {
+    "Alice", "Bob", "Carol", "David", "Eve", "Frank", "Grace", "Henry", "Ivy", "Jack", "John",
+    "Kate", "Leo", "Mia", "Noah", "Olivia", "Paul", "Quinn", "Ryan", "Sara", "Tom"
+};
+const char* const SYNTHETIC_LAST_NAMES[] = {
+    "Anderson", "Brown", "Davis", "Garcia", "Harris", "Jackson", "Johnson", "Jones", "Marston", "Martin",
+    "Martinez", "Miller", "Rodriguez", "Smith", "Taylor", "Thomas", "White", "Williams", "Wilson"
+};
+const int SYNTHETIC_FIRST_NAME_COUNT = sizeof(SYNTHETIC_FIRST_NAMES) / sizeof(SYNTHETIC_FIRST_NAMES[0]);
+const int SYNTHETIC_LAST_NAME_COUNT = sizeof(SYNTHETIC_LAST_NAMES) / sizeof(SYNTHETIC_LAST_NAMES[0]);
+
+const size_t SYNTHETIC_WRITE_BUFFER = 1 << 20; // Bytes buffered between writes
+
+struct SyntheticFleetOptions {
+    long long rows = 10000;
+    uint64_t seed = 42;
+    double seatCollisionRate = 0.0;
+    double duplicateIdRate = 0.0;
+    double classMix[SEAT_CLASS_COUNT] = {18.0 / 180, 42.0 / 180, 120.0 / 180};
+    uint32_t firstPassengerId = 100000;
+};
+
+struct SyntheticFleetSummary {
+    long long rows = 0;
+    long long seatCollisions = 0;
+    long long duplicateIds = 0;
+    long long classRows[SEAT_CLASS_COUNT] = {0, 0, 0};
+    long long bytesWritten = 0;
+};
+
+class SyntheticFleetGenerator {
+private:
+    SyntheticFleetOptions options;
+    mt19937_64 random;
+    uint32_t issuedIds;
+
+    // Per class: its seat slots in the order the current plane hands them out;
+    // the first handedOut[c] of them are taken on that plane
+    vector<int> classSlots[SEAT_CLASS_COUNT];
+    size_t handedOut[SEAT_CLASS_COUNT];
+
+    // Uniform in [0, 1) from the top 53 bits
+    double nextUnit() {
+        return static_cast<double>(random() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    // Uniform in [0, bound) (the modulo bias is negligible for these bounds)
+    uint64_t nextBelow(uint64_t bound) {
+        return random() % bound;
+    }
+
+    void shuffleSlots(vector<int>& slots) {
+        for (size_t i = slots.size(); i > 1; i--) {
+            swap(slots[i - 1], slots[nextBelow(i)]);
+        }
+    }
+
+    int pickClass() {
+        double total = 0;
+        for (double share : options.classMix) {
+            total += share;
+        }
+        double point = nextUnit() * total;
+        for (int seatClass = 0; seatClass < SEAT_CLASS_COUNT - 1; seatClass++) {
+            if (point < options.classMix[seatClass]) {
+                return seatClass;
+            }
+            point -= options.classMix[seatClass];
+        }
+        return SEAT_CLASS_COUNT - 1;
+    }
+
+public:
+    explicit SyntheticFleetGenerator(const SyntheticFleetOptions& generatorOptions)
+        : options(generatorOptions), random(generatorOptions.seed), issuedIds(0) {
+        for (int slot = 0; slot < SEAT_BITMAP_SEATS; slot++) {
+            classSlots[seatClassOfRow(slot / SEAT_BITMAP_COLUMNS)].push_back(slot);
+        }
+        for (int seatClass = 0; seatClass < SEAT_CLASS_COUNT; seatClass++) {
+            shuffleSlots(classSlots[seatClass]);
+            handedOut[seatClass] = 0;
+        }
+    }
+
+    // Appends the next CSV line (with newline) to line and updates summary
+    void appendRow(string& line, SyntheticFleetSummary& summary) {
+        uint32_t passengerId;
+        if (issuedIds > 0 && nextUnit() < options.duplicateIdRate) {
+            passengerId = options.firstPassengerId + static_cast<uint32_t>(nextBelow(issuedIds));
+            summary.duplicateIds++;
+        } else {
+            passengerId = options.firstPassengerId + issuedIds++;
+        }
+
+        int seatClass = pickClass();
+        vector<int>& slots = classSlots[seatClass];
+        size_t& taken = handedOut[seatClass];
+        int slot;
+        if (taken > 0 && nextUnit() < options.seatCollisionRate) {
+            slot = slots[nextBelow(taken)];
+            summary.seatCollisions++;
+        } else {
+            if (taken == slots.size()) {
+                shuffleSlots(slots);
+                taken = 0;
+            }
+            slot = slots[taken++];
+        }
+
+        line.append(to_string(passengerId)).append(1, ',');
+        line.append(SYNTHETIC_FIRST_NAMES[nextBelow(SYNTHETIC_FIRST_NAME_COUNT)]).append(1, ' ');
+        line.append(SYNTHETIC_LAST_NAMES[nextBelow(SYNTHETIC_LAST_NAME_COUNT)]).append(1, ',');
+        line.append(to_string(slot / SEAT_BITMAP_COLUMNS + 1)).append(1, ',');
+        line.append(1, static_cast<char>('A' + slot % SEAT_BITMAP_COLUMNS)).append(1, ',');
+        line.append(seatClass == SEAT_CLASS_FIRST ? "First" : seatClass == SEAT_CLASS_BUSINESS ? "Business" : "Economy");
+        line.append(1, '\n');
+
+        summary.rows++;
+        summary.classRows[seatClass]++;
+    }
+};
+
+// "10k" -> 10000, "1M" -> 1000000, "250" -> 250. Returns -1 if malformed.
+inline long long parseSyntheticRowCount(const string& text) {
+    if (text.empty()) {
+        return -1;
+    }
+    long long multiplier = 1;
+    string digits = text;
+    char suffix = text.back();
+    if (suffix == 'k' || suffix == 'K') {
+        multiplier = 1000;
+        digits.pop_back();
+    } else if (suffix == 'm' || suffix == 'M') {
+        multiplier = 1000000;
+        digits.pop_back();
+    }
+    if (digits.empty() || digits.size() > 9 || digits.find_first_not_of("0123456789") != string::npos) {
+        return -1;
+    }
+    return stoll(digits) * multiplier;
+}
+
+// Writes options.rows passengers (plus the header) to filePath. Returns false
+// if the file cannot be written.
+inline bool writeSyntheticFleetCSV(const string& filePath, const SyntheticFleetOptions& options,
+                                   SyntheticFleetSummary& summary) {
+    summary = SyntheticFleetSummary();
+    FILE* file = fopen(filePath.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+
+    SyntheticFleetGenerator generator(options);
+    string buffer = "PassengerID,Name,SeatRow,SeatColumn,Class\n";
+    buffer.reserve(SYNTHETIC_WRITE_BUFFER + 128);
+    bool written = true;
+    for (long long row = 0; row < options.rows && written; row++) {
+        generator.appendRow(buffer, summary);
+        if (buffer.size() >= SYNTHETIC_WRITE_BUFFER) {
+            written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+            summary.bytesWritten += static_cast<long long>(buffer.size());
+            buffer.clear();
+        }
+    }
+    if (written && !buffer.empty()) {
+        written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+        summary.bytesWritten += static_cast<long long>(buffer.size());
+    }
+    written = (fclose(file) == 0) && written;
+    return written;
+}
+
+#endif
@@ -0,0 +1,346 @@
+/*
+===============================================================================
+PLANE FLIGHT RESERVATION SYSTEM - UNROLLED LINKED LIST VERSION
+===============================================================================
+Assignment: Data Structures Assignment Task 1
+Component: Plane Reservation System (Unrolled Linked List Version)
+
+The Linked List Version stores one node per passenger, so every search walks
+one pointer (and usually one cache miss) per passenger. This version keeps
+the same ordered list, but each list element is a block of
+UNROLLED_BLOCK_CAPACITY passenger records with an occupancy mask:
+
+  - init() appends after the last record of the tail block (a new block when full)
+  - removePassengerById() clears the record's bit; an emptied block is unlinked
+    and a block that fits together with its successor is merged with it
+  - scans walk the set bits of each mask over records that sit side by side
+
+Passengers therefore come out in the same order as in the Linked List, and the
+reservation, cancellation and CSV placement logic is the same templated code,
+so both lists make identical decisions.
+
+It loads from the Linked List's snapshot / CSV and journal and never writes
+them. Main.cpp applies every operation to both lists and the Linked List
+journals it, so a reload sees the same passengers.
+
+CODE ORGANIZATION:
+- Section 1: Block Layout and List
+- Section 2: Loading
+===============================================================================
+*/
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../Shared/SeatBitmap.h"
+#include "../Shared/FleetSeatOccupancy.h"
+#include "../Shared/FleetSnapshot.h"
+
+using namespace std;
+
+/* ===========================================================
+               SECTION 1: BLOCK LAYOUT AND LIST
+   =========================================================== */
+
+const int UNROLLED_BLOCK_CAPACITY = 32; // Records per block, one occupancy bit each (16-64)
+
+static_assert(UNROLLED_BLOCK_CAPACITY >= 16 && UNROLLED_BLOCK_CAPACITY <= 64, "occupancy mask is one 64-bit word");
+
+struct UnrolledPassengerRecord {
+    string passengerId;
+    string passengerName;
+    string passengerClass;
+    int seatRow;
+    int seatColumn;
+    int planeNum;
+
+    UnrolledPassengerRecord() : seatRow(0), seatColumn(0), planeNum(0) {}
+};
+
+struct UnrolledPassengerBlock {
+    uint64_t occupancyMask;  // Bit i set = records[i] holds a passenger
+    int usedSlots;           // Records handed out so far; appends go after the last one
+    UnrolledPassengerBlock* next;
+    UnrolledPassengerRecord records[UNROLLED_BLOCK_CAPACITY];
+
+    UnrolledPassengerBlock() : occupancyMask(0), usedSlots(0), next(nullptr) {}
+
+    int liveRecords() const {
+        return popCount64(occupancyMask);
+    }
+};
+
+class UnrolledPassengerList {
+private:
+    UnrolledPassengerBlock* head;
+    UnrolledPassengerBlock* tail;
+    int totalPlanes;
+    int passengerCount;
+    int blockCount;
+
+    // Same side indexes as the Linked List, so seat questions never scan blocks
+    FleetSeatOccupancy occupancy;
+
+    // Packs the live records of a block to the front, keeping their order
+    static void compactBlock(UnrolledPassengerBlock* block) {
+        int target = 0;
+        uint64_t live = block->occupancyMask;
+        while (live != 0) {
+            int slot = countTrailingZeros64(live);
+            if (slot != target) {
+                block->records[target] = move(block->records[slot]);
+                block->records[slot] = UnrolledPassengerRecord();
+            }
+            target++;
+            live &= live - 1;
+        }
+        block->usedSlots = target;
+        block->occupancyMask = (target == 64) ? ~0ULL : ((1ULL << target) - 1);
+    }
+
+    void unlinkBlock(UnrolledPassengerBlock* previous, UnrolledPassengerBlock* block) {
+        if (previous == nullptr) {
+            head = block->next;
+        } else {
+            previous->next = block->next;
+        }
+        if (block == tail) {
+            tail = previous;
+        }
+        delete block;
+        blockCount--;
+    }
+
+    // Keeps blocks dense after a removal: an empty block is dropped, and a
+    // block whose records fit together with its successor's absorbs them,
+    // so any two neighbouring blocks hold more than one block's worth.
+    void rebalanceAfterRemoval(UnrolledPassengerBlock* previous, UnrolledPassengerBlock* block) {
+        if (block->occupancyMask == 0) {
+            unlinkBlock(previous, block);
+            return;
+        }
+
+        UnrolledPassengerBlock* following = block->next;
+        if (following == nullptr || block->liveRecords() + following->liveRecords() > UNROLLED_BLOCK_CAPACITY) {
+            return;
+        }
+
+        compactBlock(block);
+        uint64_t live = following->occupancyMask;
+        while (live != 0) {
+            int slot = countTrailingZeros64(live);
+            block->records[block->usedSlots] = move(following->records[slot]);
+            block->occupancyMask |= 1ULL << block->usedSlots;
+            block->usedSlots++;
+            live &= live - 1;
+        }
+        unlinkBlock(block, following);
+    }
+
+public:
+    UnrolledPassengerList() : head(nullptr), tail(nullptr), totalPlanes(0), passengerCount(0), blockCount(0) {}
+
+    ~UnrolledPassengerList() {
+        clear();
+    }
+
+    UnrolledPassengerList(const UnrolledPassengerList&) = delete;
+    UnrolledPassengerList& operator=(const UnrolledPassengerList&) = delete;
+
+    UnrolledPassengerList(UnrolledPassengerList&& other) noexcept
+        : head(other.head), tail(other.tail), totalPlanes(other.totalPlanes),
+          passengerCount(other.passengerCount), blockCount(other.blockCount),
+          occupancy(move(other.occupancy)) {
+        other.head = nullptr;
+        other.tail = nullptr;
+        other.totalPlanes = 0;
+        other.passengerCount = 0;
+        other.blockCount = 0;
+        other.occupancy.clear();
+    }
+
+    UnrolledPassengerList& operator=(UnrolledPassengerList&& other) noexcept {
+        if (this != &other) {
+            clear();
+            head = other.head;
+            tail = other.tail;
+            totalPlanes = other.totalPlanes;
+            passengerCount = other.passengerCount;
+            blockCount = other.blockCount;
+            occupancy = move(other.occupancy);
+            other.head = nullptr;
+            other.tail = nullptr;
+            other.totalPlanes = 0;
+            other.passengerCount = 0;
+            other.blockCount = 0;
+            other.occupancy.clear();
+        }
+        return *this;
+    }
+
+    void clear() {
+        while (head != nullptr) {
+            UnrolledPassengerBlock* following = head->next;
+            delete head;
+            head = following;
+        }
+        tail = nullptr;
+        totalPlanes = 0;
+        passengerCount = 0;
+        blockCount = 0;
+        occupancy.clear();
+    }
+
+    void init(const string& id, const string& name, int row, int column, int planeNum, const string& passengerClassType = "Economy") {
+        if (tail == nullptr || tail->usedSlots == UNROLLED_BLOCK_CAPACITY) {
+            UnrolledPassengerBlock* block = new UnrolledPassengerBlock();
+            if (tail == nullptr) {
+                head = block;
+            } else {
+                tail->next = block;
+            }
+            tail = block;
+            blockCount++;
+        }
+
+        int slot = tail->usedSlots++;
+        UnrolledPassengerRecord& record = tail->records[slot];
+        record.passengerId = id;
+        record.passengerName = name;
+        record.passengerClass = passengerClassType;
+        record.seatRow = row;
+        record.seatColumn = column;
+        record.planeNum = planeNum;
+        tail->occupancyMask |= 1ULL << slot;
+        passengerCount++;
+
+        occupancy.markSeat(row, column, planeNum, true);
+    }
+
+    int getSize() const {
+        return passengerCount;
+    }
+
+    int getBlockCount() const {
+        return blockCount;
+    }
+
+    const FleetStatistics& getStatistics() const {
+        return occupancy.getStatistics();
+    }
+
+    // Calls visit(record) for every passenger in list order
+    template <typename Visitor>
+    void forEachPassenger(Visitor visit) const {
+        for (const UnrolledPassengerBlock* block = head; block != nullptr; block = block->next) {
+            uint64_t live = block->occupancyMask;
+            while (live != 0) {
+                visit(block->records[countTrailingZeros64(live)]);
+                live &= live - 1;
+            }
+        }
+    }
+
+    UnrolledPassengerRecord* searchPassenger(const string& id) {
+        for (UnrolledPassengerBlock* block = head; block != nullptr; block = block->next) {
+            uint64_t live = block->occupancyMask;
+            while (live != 0) {
+                UnrolledPassengerRecord& record = block->records[countTrailingZeros64(live)];
+                if (record.passengerId == id) {
+                    return &record;
+                }
+                live &= live - 1;
+            }
+        }
+        return nullptr;
+    }
+
+    bool doesPassengerExists(const string& id) {
+        return searchPassenger(id) != nullptr;
+    }
+
+    bool isSeatOccupied(int seatRow, int seatColumn, int planeNumber) {
+        return occupancy.isSeatOccupied(seatRow, seatColumn, planeNumber);
+    }
+
+    // Fills seats[row][column] with the record in that seat of the plane, or nullptr
+    void getPassengersFromPlane(const UnrolledPassengerRecord* seats[][6], int planeNumber) const {
+        for (int i = 0; i < 30; i++) {
+            for (int j = 0; j < 6; j++) {
+                seats[i][j] = nullptr;
+            }
+        }
+        forEachPassenger([&](const UnrolledPassengerRecord& record) {
+            if (record.planeNum == planeNumber) {
+                seats[record.seatRow][record.seatColumn] = &record;
+            }
+        });
+    }
+
+    bool removePassengerById(const string& passengerId, PassengerNode& removedPassenger) {
+        UnrolledPassengerBlock* previous = nullptr;
+        for (UnrolledPassengerBlock* block = head; block != nullptr; previous = block, block = block->next) {
+            uint64_t live = block->occupancyMask;
+            while (live != 0) {
+                int slot = countTrailingZeros64(live);
+                UnrolledPassengerRecord& record = block->records[slot];
+                if (record.passengerId == passengerId) {
+                    removedPassenger = PassengerNode(record.passengerId, record.passengerName, record.seatRow,
+                                                     record.seatColumn, record.planeNum, record.passengerClass);
+                    occupancy.markSeat(record.seatRow, record.seatColumn, record.planeNum, false);
+                    record = UnrolledPassengerRecord();
+                    block->occupancyMask &= ~(1ULL << slot);
+                    passengerCount--;
+                    rebalanceAfterRemoval(previous, block);
+                    return true;
+                }
+                live &= live - 1;
+            }
+        }
+        return false;
+    }
+
+    void setTotalPlanes(int total) {
+        totalPlanes = total;
+        occupancy.ensurePlanes(total);
+    }
+
+    int getTotalPlanes() const {
+        return totalPlanes;
+    }
+
+    int findFirstPlaneWithSeatFree(int seatRow, int seatColumn) {
+        return occupancy.findFirstPlaneWithSeatFree(seatRow, seatColumn);
+    }
+
+    vector<int> getPlanesWithSeatOccupied(int seatRow, int seatColumn) {
+        return occupancy.getPlanesWithSeatOccupied(seatRow, seatColumn);
+    }
+
+    int findFirstPlaneWithFreeSeat(int seatClass, int maxPlaneNumber) {
+        return occupancy.findFirstPlaneWithFreeSeat(seatClass, maxPlaneNumber);
+    }
+
+    bool findFirstFreeSeat(int planeNumber, int seatClass, int& seatRow, int& seatColumn) {
+        return occupancy.findFirstFreeSeat(planeNumber, seatClass, seatRow, seatColumn);
+    }
+};
+
+/* ===========================================================
+                     SECTION 2: LOADING
+   =========================================================== */
+
+UnrolledPassengerList unrolledPassengerList;
+
+// Builds the list from the Linked List's snapshot (or its CSV when the
+// snapshot is stale) plus its journal. Nothing is written back.
+UnrolledPassengerList readUnrolledPassengerData() {
+    UnrolledPassengerList passengerList;
+    if (!readPassengerSnapshot(passengerList) && !placePassengerCSVRows(passengerList)) {
+        return passengerList;
+    }
+    applyPassengerJournal(passengerList);
+    return passengerList;
+}